@@ -26,6 +26,11 @@
 #include <stdint.h>
 #include <stdarg.h>
 #include "rstest/rstest_std_macros.h"
+#include "rstest/rstest_bench.h"
+#include "rstest/rstest_heap.h"
+#include "rstest/rstest_perf.h"
+#include "rstest/rstest_stack.h"
+#include "rstest/rstest_stress.h"
 
 #if defined(__cplusplus)
 extern "C"
@@ -42,6 +47,28 @@ extern "C"
 /// This is not the framework for you.
 #define MAX_NUM_ASSERTIONS (128)
 
+/// Maximum number of test case results in the test report.
+/// Test cases beyond this are still executed and counted but have no
+/// individual result record.
+#if !defined(MAX_NUM_TESTCASE_RESULTS)
+#define MAX_NUM_TESTCASE_RESULTS (64)
+#endif
+
+/// Maximum number of ASSERT_COMPLETES_WITHIN() sites and test case deadlines in the timing records.
+/// Sites beyond this are still checked but have no timing record.
+#if !defined(MAX_NUM_TIMING_SITES)
+#define MAX_NUM_TIMING_SITES (16)
+#endif
+
+/// Parameter index of an assertion record outside of a parameterized test case.
+#define RSTEST_NO_PARAM (UINT32_MAX)
+
+/// Maximum number of async test cases executing concurrently.
+/// Further async test cases start as executing ones complete.
+#if !defined(RSTEST_MAX_ASYNC_CASES)
+#define RSTEST_MAX_ASYNC_CASES (8)
+#endif
+
     // ------------------------------------------------------------------
     // Type Definitions
 
@@ -52,6 +79,8 @@ extern "C"
     /// Idle       -d-> Executing : START_TESTCASE()
     /// Executing  -d-> Pass      : END_TESTCASE_PASS()
     /// Executing  -d-> Fail      : ASSERT_TRUE(false) | END_TESTCASE_FAIL()
+    /// Idle       -d-> Blocked   : prerequisite did not pass
+    /// Idle       -d-> Deferred  : time budget used (rstest_runBudget())
     /// @enduml 'Test Case State
     typedef enum TestCaseState_e
     {
@@ -59,12 +88,32 @@ extern "C"
         TestCaseState_Disabled  = 1, ///< Disabled
         TestCaseState_Executing = 2, ///< In the process of Executing
         TestCaseState_Pass      = 3, ///< Completed Execution and Passed
-        TestCaseState_Fail      = 4  ///< Completed Execution and Failed
+        TestCaseState_Fail      = 4, ///< Completed Execution and Failed
+        TestCaseState_Blocked   = 5, ///< Not Executed, a prerequisite test case did not pass
+        TestCaseState_Deferred  = 6  ///< Not Executed, left out of a time budgeted run
     } TestCaseState_t;
 
     /// Test Case Function Type
     typedef void (*TestCaseFunc_t)(void);
 
+    /// Parameterized Test Case Function Type
+    /// @param[in] param pointer to the parameter within the parameter table (not a copy)
+    /// @param[in] index index of the parameter within the parameter table
+    typedef void (*TestCaseParamFunc_t)(const void *param, size_t index);
+
+    /// Async Test Case context
+    /// Resume point of a stackless async test case - see RSTEST_ASYNC_BEGIN().
+    typedef struct TestAsync_s
+    {
+        uint32_t    resume; ///< Line of the RSTEST_AWAIT() to resume at, 0 for start/complete
+        const char *file;   ///< File of the RSTEST_AWAIT() to resume at
+    } TestAsync_t;
+
+    /// Async Test Case Function Type
+    /// Called repeatedly until complete, returning whenever it waits.
+    /// @param[in,out] async resume context of the test case
+    typedef void (*TestCaseAsyncFunc_t)(TestAsync_t *async);
+
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wpadded"
@@ -73,16 +122,32 @@ extern "C"
     /// Test Case Record
     typedef struct TestCase_s
     {
-        const char     *name;  ///< TestCase Name
-        TestCaseFunc_t  func;  ///< Test Function pointer
-        TestCaseState_t state; ///< TestCase state
+        const char         *name;       ///< TestCase Name
+        TestCaseFunc_t      func;       ///< Test Function pointer (NULL when parameterized)
+        TestCaseState_t     state;      ///< TestCase state
+        TestCaseParamFunc_t paramFunc;  ///< Parameterized Test Function pointer (NULL when not parameterized)
+        const void         *params;     ///< Parameter table
+        size_t              paramCount; ///< Count of parameters in the params table
+        size_t              paramSize;  ///< Size of each parameter in the params table
+        TestCaseAsyncFunc_t asyncFunc;  ///< Async Test Function pointer (NULL when not async)
+        const char *const  *depends;    ///< NULL terminated names of prerequisite test cases (may be NULL)
+        uint64_t            deadline;   ///< Deadline of the test case body in clock ticks, 0 for none (not async)
     } TestCase_t;
 
+    /// Assertion kind
+    typedef enum AssertKind_e
+    {
+        AssertKind_Condition = 0, ///< Condition or test case state change
+        AssertKind_Timing    = 1  ///< Deadline exceeded (ASSERT_COMPLETES_WITHIN() or test case deadline)
+    } AssertKind_t;
+
     /// Assert Record type
     typedef struct AssertRecord_s
     {
-        const char *file; ///< File name
-        uint32_t    line; ///< Line number
+        const char  *file;  ///< File name
+        uint32_t     line;  ///< Line number
+        uint32_t     param; ///< Parameter index of a parameterized test case, RSTEST_NO_PARAM otherwise
+        AssertKind_t kind;  ///< Kind of assertion
     } AssertRecord_t;
 
 #if defined(__clang__)
@@ -97,23 +162,76 @@ extern "C"
     /// @param[in] user user parameter pointer
     typedef void (*TestSuiteTeardownCb_t)(void *user);
 
+    /// Fixture Startup Callback function for test suite.
+    /// Executed once per rstest_run() before any test case.
+    /// @param[in] user user parameter pointer
+    /// @returns fixture context shared by the test cases - see rstest_fixture().
+    typedef void *(*TestSuiteFixtureStartupCb_t)(void *user);
+
+    /// Fixture Teardown Callback function for test suite.
+    /// Executed once per rstest_run() after every test case.
+    /// @param[in] user user parameter pointer
+    /// @param[in] fixture fixture context returned by the fixture startup callback
+    typedef void (*TestSuiteFixtureTeardownCb_t)(void *user, void *fixture);
+
     /// Failure Callback function for test suite.
     /// @param[in] record assertion record type
     /// @param[in] user user parameter pointer
     typedef void (*TestFailureCb_t)(const AssertRecord_t *record, void *user);
 
+    /// Async Poll Callback function for test suite.
+    /// Executed when every executing async test case is waiting, e.g. to advance
+    /// simulated peripherals or wait for an interrupt.
+    /// @param[in] user user parameter pointer
+    /// @retval true to keep waiting
+    /// @retval false when nothing more can happen - waiting test cases fail
+    typedef bool (*TestAsyncPollCb_t)(void *user);
+
+    /// Clock Callback function for test suite.
+    /// @param[in] user user parameter pointer
+    /// @returns monotonic time in any unit (e.g. ns or cycles) - the unit of the baseline.
+    typedef uint64_t (*TestClockCb_t)(void *user);
+
+    /// Performance baseline - see rstest/rstest_baseline.h
+    struct TestBaseline_s;
+
+    /// Snapshot Region
+    /// Memory (a fixture struct, a simulated register file) captured after the
+    /// startup callback and restored before every later test case.
+    typedef struct TestSnapshotRegion_s
+    {
+        void  *addr; ///< Start of the region
+        void  *copy; ///< Snapshot storage of at least size bytes
+        size_t size; ///< Size of the region in bytes
+    } TestSnapshotRegion_t;
+
     /// Test Suite Structure
     typedef struct TestSuite_s
     {
-        const char           *name;           ///< TestSuite Name
-        const TestCase_t     *testCases;      ///< Array of test cases
-        size_t                count;          ///< Count of test cases in testCases array
-        TestSuiteStartupCb_t  startupCb;      ///< Callback to be performed before every test case execution
-        void                 *startupCbUser;  ///< User pointer for startup callback
-        TestSuiteTeardownCb_t teardownCb;     ///< Callback to be performed at the end of every test case execution
-        void                 *teardownCbUser; ///< User pointer for startup callback
-        TestFailureCb_t       failureCb;      ///< Callback to be performed if/when a failure occurs
-        void                 *failureCbUser;  ///< User pointer for startup callback
+        const char                  *name;                ///< TestSuite Name
+        const TestCase_t            *testCases;           ///< Array of test cases
+        size_t                       count;               ///< Count of test cases in testCases array
+        TestSuiteStartupCb_t         startupCb;           ///< Callback to be performed before every test case execution
+        void                        *startupCbUser;       ///< User pointer for startup callback
+        TestSuiteTeardownCb_t        teardownCb;          ///< Callback to be performed at the end of every test case execution
+        void                        *teardownCbUser;      ///< User pointer for startup callback
+        TestFailureCb_t              failureCb;           ///< Callback to be performed if/when a failure occurs
+        void                        *failureCbUser;       ///< User pointer for startup callback
+        const TestHeapLimits_t      *heapLimits;          ///< Heap limits per test case, NULL for none (RSTEST_HEAP_TRACKING)
+        size_t                       paramBatch;          ///< Parameters executed between startup and teardown, 0 same as 1
+        TestAsyncPollCb_t            asyncPollCb;         ///< Callback when all async test cases are waiting (may be NULL)
+        void                        *asyncPollCbUser;     ///< User pointer for async poll callback
+        TestClockCb_t                clockCb;             ///< Clock to measure test case durations (may be NULL)
+        void                        *clockCbUser;         ///< User pointer for clock callback
+        const struct TestBaseline_s *baseline;            ///< Baseline durations to compare with, NULL for none
+        TestSuiteFixtureStartupCb_t  suiteStartupCb;      ///< Callback performed once before all test cases (may be NULL)
+        void                        *suiteStartupCbUser;  ///< User pointer for suite startup callback
+        TestSuiteFixtureTeardownCb_t suiteTeardownCb;     ///< Callback performed once after all test cases (may be NULL)
+        void                        *suiteTeardownCbUser; ///< User pointer for suite teardown callback
+        const TestSnapshotRegion_t  *snapshotRegions;     ///< Regions restored in place of startupCb (may be NULL)
+        size_t                       snapshotCount;       ///< Count of snapshotRegions, 0 for startupCb per test case
+        const TestPerfLimits_t      *perfLimits;          ///< Performance limits per test case, NULL for none (RSTEST_PERF_COUNTERS)
+        const TestStack_t           *stack;               ///< Stack the test cases execute on, NULL for none (RSTEST_STACK_USAGE)
     } TestSuite_t;
 
     /// Assertion Record List
@@ -128,19 +246,78 @@ extern "C"
 #pragma clang diagnostic ignored "-Wpadded"
 #endif
 
+    /// Timing Record
+    /// Worst execution time of an ASSERT_COMPLETES_WITHIN() site or a test case deadline over the runs.
+    typedef struct TestTimingRecord_s
+    {
+        const char *name;     ///< File of the site, test case name of a test case deadline
+        uint32_t    line;     ///< Line of the site, 0 for a test case deadline
+        uint32_t    runs;     ///< Times measured
+        uint32_t    exceeded; ///< Times over the deadline
+        uint64_t    deadline; ///< Latest deadline in clock ticks
+        uint64_t    worst;    ///< Worst (longest) time in clock ticks
+        int64_t     margin;   ///< Deadline less the worst time, negative when exceeded
+    } TestTimingRecord_t;
+
+    /// Timing Record List
+    typedef struct TestTimingList_s
+    {
+        size_t             count;                         ///< Count of sites
+        TestTimingRecord_t records[MAX_NUM_TIMING_SITES]; ///< Timing Record Array
+    } TestTimingList_t;
+
+    /// Test Case Result
+    /// Result of the last execution of a test case.
+    typedef struct TestCaseResult_s
+    {
+        const char     *name;           ///< TestCase Name
+        TestCaseState_t state;          ///< TestCase state at the end of execution
+        uint32_t        paramCount;     ///< Parameters executed (parameterized test case only)
+        uint32_t        paramFailCount; ///< Parameters that failed (parameterized test case only)
+        uint32_t        paramFirstFail; ///< Index of the first failing parameter, RSTEST_NO_PARAM if none
+        uint64_t        duration;       ///< Minimum duration over the runs in clock ticks (clockCb)
+        uint32_t        durationRuns;   ///< Count of runs with a measured duration
+        bool            regressed;      ///< Slower than the baseline beyond the noise model
+        uint32_t        level;          ///< Dependency level, test cases of the same level are independent
+        uint64_t        dataSeed;       ///< Seed of the latest dataset of the test case (rstest_dataGet), 0 for none
+#if defined(RSTEST_HEAP_TRACKING)
+        TestHeapStats_t heap; ///< Heap usage of the test case
+#endif
+#if defined(RSTEST_PERF_COUNTERS)
+        TestPerfStats_t perf; ///< Performance counters of the test case body
+#endif
+#if defined(RSTEST_STACK_USAGE)
+        TestStackStats_t stack; ///< Stack usage of the test case
+#endif
+    } TestCaseResult_t;
+
+    /// Test Case Result List
+    /// Indexed the same as the TestSuite testCases array.
+    typedef struct TestCaseResultList_s
+    {
+        size_t           count;                             ///< Count of valid results
+        TestCaseResult_t records[MAX_NUM_TESTCASE_RESULTS]; ///< Test Case Result Array
+    } TestCaseResultList_t;
+
     /// Test Report
     typedef struct TestReport_s
     {
-        const char        *name;          ///< TestSuite name
-        const char        *date;          ///< Compilation Date
-        const char        *time;          ///< Compilation Time
-        uint32_t           testCount;     ///< Total Test cases
-        uint32_t           disabledCount; ///< Total Disabled Test cases
-        uint32_t           executedCount; ///< Total Executed Test cases
-        uint32_t           passCount;     ///< Total Passed Test cases
-        uint32_t           failCount;     ///< Total Failed Test cases
-        AssertRecordList_t failAsserts;   ///< List of failing assert records
-        AssertRecordList_t passAsserts;   ///< List of passing assert records
+        const char          *name;            ///< TestSuite name
+        const char          *date;            ///< Compilation Date
+        const char          *time;            ///< Compilation Time
+        uint32_t             testCount;       ///< Total Test cases
+        uint32_t             disabledCount;   ///< Total Disabled Test cases
+        uint32_t             executedCount;   ///< Total Executed Test cases
+        uint32_t             passCount;       ///< Total Passed Test cases
+        uint32_t             failCount;       ///< Total Failed Test cases
+        uint32_t             blockedCount;    ///< Total Blocked Test cases (prerequisite did not pass)
+        uint32_t             deferredCount;   ///< Total Deferred Test cases (time budget used)
+        AssertRecordList_t   failAsserts;     ///< List of failing assert records
+        AssertRecordList_t   passAsserts;     ///< List of passing test case state change records
+        uint32_t             passAssertCount; ///< Total passing ASSERT_TRUE() (counted only, not recorded)
+        uint32_t             regressionCount; ///< Test cases slower than the baseline (caseResults regressed)
+        TestCaseResultList_t caseResults;     ///< Results of the last execution of each test case
+        TestTimingList_t     timing;          ///< Worst execution times of the timed sites
     } TestReport_t;
 
 #if defined(__clang__)
@@ -151,6 +328,23 @@ extern "C"
 // Defines helpers to simplify writing test cases
 // These are to be performed within a testcase function.
 
+/// Assertion record of the current location.
+/// The parameter index is filled in by the framework when recorded.
+#define ASSERT_RECORD() (&(AssertRecord_t){__FILENAME__, __LINE__, RSTEST_NO_PARAM, AssertKind_Condition})
+
+/// Timing assertion record of the current location.
+#define ASSERT_TIMING_RECORD() (&(AssertRecord_t){__FILENAME__, __LINE__, RSTEST_NO_PARAM, AssertKind_Timing})
+
+/// Count a passing assertion - atomic while test case bodies execute on several threads (stress test cases).
+#if defined(__GNUC__) || defined(__clang__)
+#define RSTEST_ASSERT_PASS()                                                       \
+    (RSTEST_UNLIKELY(rstest_assertThreaded)                                        \
+         ? (void)__atomic_fetch_add(&rstest_assertPassCount, 1U, __ATOMIC_RELAXED) \
+         : (void)(rstest_assertPassCount++))
+#else
+#define RSTEST_ASSERT_PASS() (void)(rstest_assertPassCount++)
+#endif
+
 // When MINIMAL_INFO - the first error causes an abort which will cause the
 // abort handler (suggest a non return while loop) to execute.
 #if defined(RSTEST_MINIMAL_INFO)
@@ -169,35 +363,99 @@ extern "C"
 /// Confirms that the condition is true and if not, then assert and update test
 /// state
 /// @param[in] cond condition to check
-#define ASSERT_TRUE(cond) \
-    if (!(cond))          \
-    {                     \
-        abort();          \
+#define ASSERT_TRUE(cond)         \
+    if (RSTEST_UNLIKELY(!(cond))) \
+    {                             \
+        abort();                  \
     }
 
+/// Deadline check
+/// Executes the statement and confirms it completed within the budget.
+/// @param[in] budget deadline in clock ticks of the test suite (clockCb)
+/// @param[in] stmt statement to time
+#define ASSERT_COMPLETES_WITHIN(budget, stmt)                                                      \
+    do                                                                                             \
+    {                                                                                              \
+        const uint64_t rstestStart_ = rstest_readClock();                                          \
+        stmt;                                                                                      \
+        if (RSTEST_UNLIKELY(!rstest_assertWithin(ASSERT_TIMING_RECORD(), rstestStart_, (budget)))) \
+        {                                                                                          \
+            abort();                                                                               \
+        }                                                                                          \
+    } while (0)
+
 #else
 
 /// Start Test Case
 /// Add this macro within the testcase function to mark a positive
 /// assertion that the testcase in-fact started and change the state
 /// of the test to Executing.
-#define START_TESTCASE() \
-    (void)rstest_changeTestCaseState(&(AssertRecord_t){__FILENAME__, __LINE__}, TestCaseState_Executing)
+#define START_TESTCASE() (void)rstest_changeTestCaseState(ASSERT_RECORD(), TestCaseState_Executing)
 /// End Test Case Pass
-#define END_TESTCASE_PASS() \
-    (void)rstest_changeTestCaseState(&(AssertRecord_t){__FILENAME__, __LINE__}, TestCaseState_Pass)
+#define END_TESTCASE_PASS() (void)rstest_changeTestCaseState(ASSERT_RECORD(), TestCaseState_Pass)
 /// End Test Case Fail
-#define END_TESTCASE_FAIL() \
-    (void)rstest_changeTestCaseState(&(AssertRecord_t){__FILENAME__, __LINE__}, TestCaseState_Fail)
+#define END_TESTCASE_FAIL() (void)rstest_changeTestCaseState(ASSERT_RECORD(), TestCaseState_Fail)
 
 /// Assertion check
 /// Confirms that the condition is true and if not, then assert and update test
-/// state
+/// state. Passing is inline and only counted, failing is recorded out of line.
 /// @param[in] cond condition to check
-#define ASSERT_TRUE(cond) (void)rstest_assertTrue(&(AssertRecord_t){__FILENAME__, __LINE__}, cond)
+#define ASSERT_TRUE(cond) (RSTEST_LIKELY(cond) ? RSTEST_ASSERT_PASS() : rstest_assertFail(__FILE__, __LINE__))
+
+/// Deadline check
+/// Executes the statement and confirms it completed within the budget, the
+/// worst time of the site is kept in the timing records of the report.
+/// Exceeding the budget fails with an AssertKind_Timing record.
+/// @param[in] budget deadline in clock ticks of the test suite (clockCb)
+/// @param[in] stmt statement to time
+#define ASSERT_COMPLETES_WITHIN(budget, stmt)                                      \
+    do                                                                             \
+    {                                                                              \
+        const uint64_t rstestStart_ = rstest_readClock();                          \
+        stmt;                                                                      \
+        (void)rstest_assertWithin(ASSERT_TIMING_RECORD(), rstestStart_, (budget)); \
+    } while (0)
 
 #endif // defined(RSTEST_MINIMAL_INFO)
 
+// ------------------------------------------------------------------
+// Defines helpers for async (cooperative) test cases.
+// The async testcase function is re-entered from the top every time it is
+// resumed: local variables are NOT preserved across RSTEST_AWAIT(), use
+// static variables instead. RSTEST_AWAIT() cannot be used within a switch.
+
+/// Begin the body of an async testcase
+/// @param[in] async TestAsync_t context parameter of the testcase function
+#define RSTEST_ASYNC_BEGIN(async) \
+    switch ((async)->resume)      \
+    {                             \
+    case 0U:
+
+/// Wait (without blocking other async testcases) until cond is true.
+/// @param[in] async TestAsync_t context parameter of the testcase function
+/// @param[in] cond condition or event to wait for - re-evaluated every resume
+#define RSTEST_AWAIT(async, cond)         \
+    do                                    \
+    {                                     \
+        (async)->resume = __LINE__;       \
+        (async)->file   = __FILENAME__;   \
+        RSTEST_FALLTHROUGH;               \
+    case __LINE__:                        \
+        if (!(cond))                      \
+        {                                 \
+            return;                       \
+        }                                 \
+        (async)->resume = 0U;             \
+    } while (0)
+
+/// End the body of an async testcase
+/// @param[in] async TestAsync_t context parameter of the testcase function
+#define RSTEST_ASYNC_END(async) \
+    default:                    \
+        break;                  \
+        }                       \
+        (async)->resume = 0U
+
 // ------------------------------------------------------------------
 // Defines helpers to specify a testcase
 
@@ -215,9 +473,87 @@ extern "C"
 /// @param[in] func Function that defines the testcase
 /// @param[in] state initial TestCaseState_t of the testcase, can only be Idle, Disabled
 /// @post when the Test suite is defined all tests are checked that they have a proper initial TestCaseState
-#define TESTCASE_DEF(func, state) \
-    {                             \
-        (#func), (func), (state)  \
+#define TESTCASE_DEF(func, state)                                    \
+    {                                                                \
+        (#func), (func), (state), NULL, NULL, 0U, 0U, NULL, NULL, 0U \
+    }
+
+/// Test Case with a deadline Define
+/// The test case fails with an AssertKind_Timing record when its body takes
+/// longer than the deadline, the worst time is kept in the timing records of the report.
+/// @param[in] func Function that defines the testcase
+/// @param[in] deadline deadline of the test case body in clock ticks of the test suite (clockCb)
+/// @param[in] state initial TestCaseState_t of the testcase, can only be Idle, Disabled
+#define TESTCASE_DEADLINE_DEF(func, deadline, state)                         \
+    {                                                                        \
+        (#func), (func), (state), NULL, NULL, 0U, 0U, NULL, NULL, (deadline) \
+    }
+
+/// Test Case with prerequisites Define
+/// The test case is executed after its prerequisite test cases, and is Blocked
+/// (not executed) when one of them does not pass.
+/// @code
+///    static const char *const k_needsInit[] = {"TC_PeripheralInit", NULL};
+///    TestCase_t testCases[] = {TESTCASE_DEPENDS_DEF(TC_PeripheralRead, k_needsInit, TestCaseState_Idle),
+///                              TESTCASE_DEF(TC_PeripheralInit, TestCaseState_Idle)};
+/// @endcode
+/// @param[in] func function that defines the test case
+/// @param[in] depends NULL terminated names of the prerequisite test cases
+/// @param[in] state initial state of the test case, can only be Idle, Disabled
+#define TESTCASE_DEPENDS_DEF(func, depends, state)                        \
+    {                                                                     \
+        (#func), (func), (state), NULL, NULL, 0U, 0U, NULL, (depends), 0U \
+    }
+
+/// Parameterized Test Case Define
+/// For defining a testcase executed once for every entry of a const parameter
+/// table. The testcase function receives a pointer into the table (no copy) and
+/// the index of the entry, and results are reported per parameter index.
+/// @code
+///    typedef struct { uint32_t in; uint32_t out; } Vector_t;
+///    static const Vector_t k_vectors[] = {{1, 2}, {2, 4}};
+///    void TC_Double(const void *param, size_t index);
+///    ...
+///    TestCase_t k_TestCases[] = {
+///         TESTCASE_PARAM_DEF(TC_Double, k_vectors, ARRAY_SIZE(k_vectors), TestCaseState_Idle),
+///    };
+/// @endcode
+/// Within the testcase function START_TESTCASE(), END_TESTCASE_PASS() etc. apply
+/// to the current parameter.
+/// @param[in] func Function that defines the testcase (TestCaseParamFunc_t)
+/// @param[in] table parameter table (array)
+/// @param[in] count count of entries in the parameter table to execute
+/// @param[in] state initial TestCaseState_t of the testcase, can only be Idle, Disabled
+#define TESTCASE_PARAM_DEF(func, table, count, state)                                        \
+    {                                                                                        \
+        (#func), NULL, (state), (func), (table), (count), sizeof((table)[0]), NULL, NULL, 0U \
+    }
+
+/// Async Test Case Define
+/// For defining a cooperative (stackless) testcase that waits on events with
+/// RSTEST_AWAIT(). Async testcases are executed after the other testcases,
+/// interleaved on the same thread, so their waits overlap.
+/// @code
+///    void TC_UartReply(TestAsync_t *async)
+///    {
+///        RSTEST_ASYNC_BEGIN(async);
+///        START_TESTCASE();
+///        uart_send(request);
+///        RSTEST_AWAIT(async, uart_replied());
+///        ASSERT_TRUE(uart_reply() == expected);
+///        END_TESTCASE_PASS();
+///        RSTEST_ASYNC_END(async);
+///    }
+///    ...
+///    TestCase_t k_TestCases[] = {
+///         TESTCASE_ASYNC_DEF(TC_UartReply, TestCaseState_Idle),
+///    };
+/// @endcode
+/// @param[in] func Function that defines the testcase (TestCaseAsyncFunc_t)
+/// @param[in] state initial TestCaseState_t of the testcase, can only be Idle, Disabled
+#define TESTCASE_ASYNC_DEF(func, state)                              \
+    {                                                                \
+        (#func), NULL, (state), NULL, NULL, 0U, 0U, (func), NULL, 0U \
     }
 
     // ------------------------------------------------------------------
@@ -237,6 +573,17 @@ extern "C"
     /// @returns a pointer to the Test Report.
     const TestReport_t *rstest_getReport(void);
 
+    // ------------------------------------------------------------------
+    // Test case API
+
+    /// Get the fixture context of the running test suite.
+    /// @returns the context returned by the suiteStartupCb, NULL when none.
+    void *rstest_fixture(void);
+
+    /// Read the clock of the test suite (clockCb).
+    /// @returns the clock, 0 when the test suite has no clock (or is not initialized)
+    uint64_t rstest_readClock(void);
+
     // ------------------------------------------------------------------
     // Internal functions
     // Not expected to be called (use the macros)
@@ -257,15 +604,43 @@ extern "C"
     ///     when false condition and failure are identified.
     TestCaseState_t rstest_assertTrue(const AssertRecord_t *rec, bool cond);
 
+    /// Deadline check function - see ASSERT_COMPLETES_WITHIN().
+    /// Nothing is timed without a clock or outside of rstest_run().
+    /// @param[in] rec assertion record (where the deadline check takes place)
+    /// @param[in] start clock before the timed statement (rstest_readClock())
+    /// @param[in] budget deadline in clock ticks
+    /// @retval true when completed within the budget (or not timed)
+    /// @retval false when the budget was exceeded
+    bool rstest_assertWithin(const AssertRecord_t *rec, uint64_t start, uint64_t budget);
+
+    /// Count of passing ASSERT_TRUE() of the running test suite - the inline pass path.
+    extern uint32_t rstest_assertPassCount;
+
+    /// Test case bodies execute on several threads (stress test cases) - passing assertions are counted atomically.
+    extern bool rstest_assertThreaded;
+
+    /// Assertion failure handler - the out of line fail path of ASSERT_TRUE().
+    /// @param[in] file file of the assertion (path is removed)
+    /// @param[in] line line of the assertion
+    RSTEST_COLD void rstest_assertFail(const char *file, uint32_t line);
+
     /// Initialize the rtest with the TestSuite
     /// @param[in] testSuite the test suite to initalize.
     /// @retval true if initialization worked (correct state and input)
     /// @retval false otherwise
     bool rstest_init(const TestSuite_t *testSuite);
 
+    /// Initialize the rtest with a TestSuite validated at compile time (rstest.hpp)
+    /// Same as rstest_init() without checking the test cases.
+    /// @param[in] testSuite the test suite to initalize.
+    /// @retval true if initialization worked
+    /// @retval false otherwise
+    bool rstest_initValidated(const TestSuite_t *testSuite);
+
     /// Run the test suite
     /// @retval true if ran
-    /// @retval false otherwise
+    /// @retval false otherwise (not initialized, or a checkpoint store set and more than
+    ///         RSTEST_CHECKPOINT_MAX_CASES test cases - rstest/rstest_checkpoint.h)
     bool rstest_run(void);
 
 #if defined(__cplusplus)
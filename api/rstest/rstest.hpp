@@ -0,0 +1,360 @@
+/// @copyright 2023 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork C++20 front-end (header only).
+/// Builds a TestSuite at compile time so a malformed suite does not compile:
+///  - Initial states of the test cases must be Idle or Disabled.
+///  - Every test case has exactly one of a test, parameterized or async function.
+///  - Test case names (and their hashes) are unique.
+///  - Prerequisites (dependsOn()) exist, are not async and have no cycle.
+/// The C TestSuite_t is emitted as constant data - only the test cases (whose
+/// state is recorded while running) are mutable, constant initialized.
+/// @code
+///    constexpr std::array k_cases{
+///        rstest::testCase("TC_Example1", &TC_Example1),
+///        rstest::testCase("TC_Example2", &TC_Example2, TestCaseState_Disabled),
+///        rstest::paramTestCase("TC_Double", &TC_Double, k_vectors),
+///    };
+///    using ExampleSuite = rstest::Suite<"Example", k_cases>;
+///    ...
+///    rstest::init<ExampleSuite>();
+///    rstest_run();
+/// @endcode
+//
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "rstest/rstest.h"
+
+namespace rstest
+{
+
+// ------------------------------------------------------------------
+// Compile time helpers
+
+/// Test case / test suite name hash (32 bit FNV-1a).
+/// @param[in] name name to hash
+/// @returns the hash of the name
+[[nodiscard]] constexpr uint32_t nameHash(std::string_view name) noexcept
+{
+    uint32_t hash = 2166136261U;
+    for (const char c : name)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/// Fixed size string usable as a template parameter (the test suite name).
+template <std::size_t N>
+struct FixedString
+{
+    /// Constructor from a string literal
+    /// @param[in] str string literal
+    consteval FixedString(const char (&str)[N]) noexcept // NOLINT(google-explicit-constructor)
+    {
+        for (std::size_t idx = 0U; idx < N; idx++)
+        {
+            value[idx] = str[idx];
+        }
+    }
+
+    char value[N] = {}; ///< Null terminated string
+};
+
+/// Test case definition - equivalent of TESTCASE_DEF().
+/// @param[in] name name of the test case
+/// @param[in] func function that defines the test case
+/// @param[in] state initial state of the test case, can only be Idle, Disabled
+/// @returns the test case
+[[nodiscard]] consteval TestCase_t testCase(const char *name, TestCaseFunc_t func,
+                                            TestCaseState_t state = TestCaseState_Idle) noexcept
+{
+    TestCase_t tc{};
+    tc.name  = name;
+    tc.func  = func;
+    tc.state = state;
+    return tc;
+}
+
+/// Parameterized test case definition - equivalent of TESTCASE_PARAM_DEF().
+/// @param[in] name name of the test case
+/// @param[in] func function that defines the test case for one parameter
+/// @param[in] table parameter table
+/// @param[in] state initial state of the test case, can only be Idle, Disabled
+/// @returns the test case
+template <typename T, std::size_t N>
+[[nodiscard]] consteval TestCase_t paramTestCase(const char *name, TestCaseParamFunc_t func, const T (&table)[N],
+                                                 TestCaseState_t state = TestCaseState_Idle) noexcept
+{
+    TestCase_t tc{};
+    tc.name       = name;
+    tc.state      = state;
+    tc.paramFunc  = func;
+    tc.params     = &(table[0]);
+    tc.paramCount = N;
+    tc.paramSize  = sizeof(T);
+    return tc;
+}
+
+/// Async test case definition - equivalent of TESTCASE_ASYNC_DEF().
+/// @param[in] name name of the test case
+/// @param[in] func function that defines the async test case
+/// @param[in] state initial state of the test case, can only be Idle, Disabled
+/// @returns the test case
+[[nodiscard]] consteval TestCase_t asyncTestCase(const char *name, TestCaseAsyncFunc_t func,
+                                                 TestCaseState_t state = TestCaseState_Idle) noexcept
+{
+    TestCase_t tc{};
+    tc.name      = name;
+    tc.state     = state;
+    tc.asyncFunc = func;
+    return tc;
+}
+
+/// Add prerequisites to a test case - equivalent of TESTCASE_DEPENDS_DEF().
+/// @param[in] tc test case
+/// @param[in] names NULL terminated names of the prerequisite test cases (static storage)
+/// @returns the test case
+[[nodiscard]] consteval TestCase_t dependsOn(TestCase_t tc, const char *const *names) noexcept
+{
+    tc.depends = names;
+    return tc;
+}
+
+/// Add a deadline to a test case - equivalent of TESTCASE_DEADLINE_DEF().
+/// @param[in] tc test case (not async)
+/// @param[in] ticks deadline of the test case body in clock ticks of the test suite
+/// @returns the test case
+[[nodiscard]] consteval TestCase_t withDeadline(TestCase_t tc, uint64_t ticks) noexcept
+{
+    tc.deadline = ticks;
+    return tc;
+}
+
+/// Find a test case by its name.
+/// @param[in] cases test cases
+/// @param[in] name name of the test case
+/// @returns the test case index, N when not found.
+template <std::size_t N>
+[[nodiscard]] consteval std::size_t findTestCase(const std::array<TestCase_t, N> &cases, std::string_view name) noexcept
+{
+    std::size_t idx = 0U;
+    while ((idx < N) && (std::string_view{cases[idx].name} != name))
+    {
+        idx++;
+    }
+    return idx;
+}
+
+/// Dependency levels of the test cases - one more than the highest of the
+/// prerequisites, test cases of the same level are independent.
+/// @param[in] cases test cases
+/// @returns the levels, N for test cases with invalid prerequisites or in a cycle
+template <std::size_t N>
+[[nodiscard]] consteval std::array<uint32_t, N> dependsLevels(const std::array<TestCase_t, N> &cases) noexcept
+{
+    constexpr uint32_t      invalid = static_cast<uint32_t>(N);
+    std::array<uint32_t, N> levels{};
+    std::array<bool, N>     known{};
+    bool                    progress = true;
+    while (progress)
+    {
+        progress = false;
+        for (std::size_t idx = 0U; idx < N; idx++)
+        {
+            uint32_t level = 0U;
+            bool     ready = !known[idx];
+            for (const char *const *name = cases[idx].depends; ready && (name != nullptr) && (*name != nullptr); name++)
+            {
+                const std::size_t depend = findTestCase(cases, *name);
+                if ((depend == N) || (depend == idx) || (cases[depend].asyncFunc != nullptr))
+                {
+                    level = invalid;
+                }
+                else if (!known[depend])
+                {
+                    ready = false;
+                }
+                else
+                {
+                    level = std::max(level, (levels[depend] == invalid) ? invalid : (levels[depend] + 1U));
+                }
+            }
+            if (ready)
+            {
+                levels[idx] = level;
+                known[idx]  = true;
+                progress    = true;
+            }
+        }
+    }
+    for (std::size_t idx = 0U; idx < N; idx++)
+    {
+        levels[idx] = known[idx] ? levels[idx] : invalid;
+    }
+    return levels;
+}
+
+/// Are the prerequisites of the test cases valid? Existing, not async and without a cycle.
+/// @param[in] cases test cases
+/// @retval true when valid
+/// @retval false otherwise
+template <std::size_t N>
+[[nodiscard]] consteval bool validDepends(const std::array<TestCase_t, N> &cases) noexcept
+{
+    for (const uint32_t level : dependsLevels(cases))
+    {
+        if (level >= N)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Are the initial states and functions of the test cases valid? Same checks as rstest_init().
+/// @param[in] cases test cases
+/// @retval true when every test case is Idle or Disabled with exactly one function
+/// @retval false otherwise
+template <std::size_t N>
+[[nodiscard]] consteval bool validTestCases(const std::array<TestCase_t, N> &cases) noexcept
+{
+    for (const TestCase_t &tc : cases)
+    {
+        const unsigned funcCount = ((tc.func != nullptr) ? 1U : 0U) + ((tc.paramFunc != nullptr) ? 1U : 0U) +
+                                   ((tc.asyncFunc != nullptr) ? 1U : 0U);
+        if (((tc.state != TestCaseState_Idle) && (tc.state != TestCaseState_Disabled)) || (funcCount != 1U) ||
+            (tc.name == nullptr))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Are the names (and name hashes) of the test cases unique?
+/// @param[in] cases test cases
+/// @retval true when unique
+/// @retval false otherwise
+template <std::size_t N>
+[[nodiscard]] consteval bool uniqueNames(const std::array<TestCase_t, N> &cases) noexcept
+{
+    for (std::size_t idx = 0U; idx < N; idx++)
+    {
+        for (std::size_t other = idx + 1U; other < N; other++)
+        {
+            if ((std::string_view{cases[idx].name} == std::string_view{cases[other].name}) ||
+                (nameHash(cases[idx].name) == nameHash(cases[other].name)))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------
+// Test Suite
+
+/// Compile time validated Test Suite.
+/// @tparam Name name of the test suite
+/// @tparam Cases constexpr array of test cases (testCase(), paramTestCase(), asyncTestCase())
+/// @tparam Base callbacks and options of the test suite - name, testCases and count are ignored
+template <FixedString Name, const auto &Cases, TestSuite_t Base = TestSuite_t{}>
+class Suite
+{
+public:
+    /// Count of test cases
+    static constexpr std::size_t count = Cases.size();
+
+    static_assert(count != 0U, "Test suite has no test cases");
+    static_assert(validTestCases(Cases), "Test case initial state must be Idle or Disabled with exactly one function");
+    static_assert(uniqueNames(Cases), "Test case names must be unique");
+    static_assert(validDepends(Cases), "Test case prerequisites must exist, not be async and not form a cycle");
+
+    /// Name hash of the test suite
+    static constexpr uint32_t hash = nameHash(Name.value);
+
+    /// Name hashes of the test cases - same index as the test cases.
+    static constexpr std::array<uint32_t, count> nameHashes = []() {
+        std::array<uint32_t, count> hashes{};
+        for (std::size_t idx = 0U; idx < count; idx++)
+        {
+            hashes[idx] = nameHash(Cases[idx].name);
+        }
+        return hashes;
+    }();
+
+    /// Dependency levels of the test cases - same index as the test cases.
+    /// Test cases of the same level do not depend on each other and can execute concurrently.
+    static constexpr std::array<uint32_t, count> levels = dependsLevels(Cases);
+
+    /// Find the index of a test case by its name hash.
+    /// @param[in] caseHash name hash of the test case
+    /// @returns the test case index, count when not found.
+    [[nodiscard]] static constexpr std::size_t indexOf(uint32_t caseHash) noexcept
+    {
+        std::size_t idx = 0U;
+        while ((idx < count) && (nameHashes[idx] != caseHash))
+        {
+            idx++;
+        }
+        return idx;
+    }
+
+    /// Find the index of a test case by its name.
+    /// @param[in] name name of the test case
+    /// @returns the test case index, count when not found.
+    [[nodiscard]] static constexpr std::size_t indexOf(std::string_view name) noexcept
+    {
+        return indexOf(nameHash(name));
+    }
+
+    /// Test cases - state is recorded by rstest_run() so not const, but constant initialized.
+    static constinit inline std::array<TestCase_t, count> testCases = Cases;
+
+    /// The C TestSuite
+    static constexpr TestSuite_t testSuite = []() {
+        TestSuite_t suite = Base;
+        suite.name        = Name.value;
+        suite.testCases   = testCases.data();
+        suite.count       = count;
+        return suite;
+    }();
+};
+
+/// Initialize rstest with a compile time validated Test Suite - no test case checks at startup.
+/// @tparam S rstest::Suite to initialize with
+/// @retval true if initialization worked
+/// @retval false otherwise
+template <typename S>
+bool init() noexcept
+{
+    return rstest_initValidated(&S::testSuite);
+}
+
+} // namespace rstest
@@ -0,0 +1,131 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork performance baseline.
+/// Test case durations (measured with the TestSuite clockCb) are compared with
+/// a baseline - compiled in as constant data on a target or loaded from a
+/// baseline file on a host, e.g. saved from the report of a previous run.
+///
+/// A test case regresses when the minimum duration over the runs (repeated
+/// rstest_run()) exceeds the baseline by more than the noise model allows:
+///     duration > baseline + max(baseline * relativePermille / 1000, minDelta)
+/// Regressions are a distinct failure category of the report (regressionCount),
+/// the test case state itself is not changed.
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Maximum number of entries of a baseline file.
+#if !defined(RSTEST_BASELINE_MAX_ENTRIES)
+#define RSTEST_BASELINE_MAX_ENTRIES (64)
+#endif
+
+/// Maximum test case name length of a baseline file entry (including the null terminator).
+#if !defined(RSTEST_BASELINE_NAME_SIZE)
+#define RSTEST_BASELINE_NAME_SIZE (64)
+#endif
+
+/// Default Noise Model initializer - 10% and 1 tick slower, judged on a single run.
+#define RSTEST_NOISE_MODEL_DEFAULT \
+    {                              \
+        100U, 1U, 1U               \
+    }
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Noise Model - how much slower than the baseline is still not a regression.
+    typedef struct TestNoiseModel_s
+    {
+        uint32_t relativePermille; ///< Allowed slow down relative to the baseline in 1/1000
+        uint64_t minDelta;         ///< Allowed slow down in clock ticks (whichever is larger)
+        uint32_t minRuns;          ///< Runs (repeated rstest_run()) needed before judging, minimum taken
+    } TestNoiseModel_t;
+
+    /// Baseline Entry - duration of a test case.
+    typedef struct TestBaselineEntry_s
+    {
+        const char *name;     ///< TestCase Name
+        uint64_t    duration; ///< Baseline duration in clock ticks
+    } TestBaselineEntry_t;
+
+    /// Baseline of a test suite.
+    typedef struct TestBaseline_s
+    {
+        const TestBaselineEntry_t *entries; ///< Baseline entries (test cases without one are not compared)
+        size_t                     count;   ///< Count of entries
+        TestNoiseModel_t           noise;   ///< Noise model
+    } TestBaseline_t;
+
+    /// Baseline loaded from a file.
+    typedef struct TestBaselineFile_s
+    {
+        TestBaseline_t      baseline;                                                     ///< Loaded baseline
+        TestBaselineEntry_t entries[RSTEST_BASELINE_MAX_ENTRIES];                         ///< Entries
+        char                names[RSTEST_BASELINE_MAX_ENTRIES][RSTEST_BASELINE_NAME_SIZE]; ///< Entry names
+    } TestBaselineFile_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    // ------------------------------------------------------------------
+    // Host API - baseline files, one "<test case name> <duration>" per line
+    // ('#' starts a comment line).
+
+    /// Load a baseline file.
+    /// @param[out] file loaded baseline (noise model is set to RSTEST_NOISE_MODEL_DEFAULT)
+    /// @param[in] path baseline file
+    /// @retval true when loaded
+    /// @retval false when unable to read, malformed or too many entries
+    bool rstest_baselineLoad(TestBaselineFile_t *file, const char *path);
+
+    /// Save the test case durations of a report as a baseline file.
+    /// @param[in] report report of a completed test suite
+    /// @param[in] path baseline file
+    /// @retval true when saved
+    /// @retval false when unable to write
+    bool rstest_baselineSave(const TestReport_t *report, const char *path);
+
+    /// Monotonic host clock - a TestClockCb_t.
+    /// @param[in] user unused
+    /// @returns monotonic time in ns
+    uint64_t rstest_hostClockNs(void *user);
+
+#if defined(__cplusplus)
+}
+#endif
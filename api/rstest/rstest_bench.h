@@ -0,0 +1,111 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork paired A/B benchmark.
+/// Compares an old and a new implementation of the same work within one test
+/// case instead of two separate runs, so machine noise (frequency scaling,
+/// other processes, cache state) affects both alike. Each pair measures both
+/// implementations back to back in a randomized order (AB or BA) with the
+/// clock of the test suite; the ratio new/old of every pair gives the mean
+/// ratio and its 95% confidence interval.
+///
+/// The benchmark is a parameterized test case with the benchmark definition as
+/// its only parameter - it lives in the testCases array and writes its ratio to
+/// the result of the definition, so the result of every test case does not
+/// carry one.
+/// @code
+///    static TestBenchResult_t   k_crcRatio;
+///    static const TestBenchAB_t k_crcBench = {&CrcTable, &CrcSlice8, NULL, 64U, 100U, 50U, 0U, &k_crcRatio};
+///    TestCase_t k_TestCases[] = {
+///         TESTCASE_DEF(TC_Crc, TestCaseState_Idle),
+///         TESTCASE_BENCH_DEF(TC_CrcBench, k_crcBench, TestCaseState_Idle), //< new at least 5% faster
+///    };
+/// @endcode
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest_std_macros.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Minimum speedup value for no check - the ratio is only reported.
+#define RSTEST_BENCH_NO_CHECK (UINT32_MAX)
+
+/// Paired A/B Benchmark Test Case Define
+/// The test case fails when the new implementation is not faster than the old
+/// by at least minFasterPermille over the whole confidence interval.
+/// @param[in] name name of the test case
+/// @param[in] bench benchmark definition (TestBenchAB_t object, not a copy)
+/// @param[in] state initial TestCaseState_t of the testcase, can only be Idle, Disabled
+#define TESTCASE_BENCH_DEF(name, bench, state)                                               \
+    {                                                                                        \
+        (#name), NULL, (state), &rstest_benchAB, &(bench), 1U, sizeof(bench), NULL, NULL, 0U \
+    }
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Implementation under benchmark.
+    /// @param[in] user user parameter pointer
+    typedef void (*TestBenchFunc_t)(void *user);
+
+    /// Paired A/B Benchmark result - ratios of the new to the old duration in permille (below 1000 is faster).
+    typedef struct TestBenchResult_s
+    {
+        uint32_t pairs;          ///< Pairs with both durations measured (not 0), 0 when not benchmarked
+        uint32_t ratioPermille;  ///< Mean ratio
+        uint32_t ciLowPermille;  ///< Lower bound of the 95% confidence interval of the ratio
+        uint32_t ciHighPermille; ///< Upper bound of the 95% confidence interval of the ratio
+    } TestBenchResult_t;
+
+    /// Paired A/B Benchmark definition
+    typedef struct TestBenchAB_s
+    {
+        TestBenchFunc_t    oldFunc;           ///< Old implementation (A)
+        TestBenchFunc_t    newFunc;           ///< New implementation (B)
+        void              *user;              ///< User pointer for both implementations
+        uint32_t           pairs;             ///< Count of pairs measured, at least 2
+        uint32_t           iterations;        ///< Calls of an implementation per measurement, 0 same as 1
+        uint32_t           minFasterPermille; ///< New faster than old by at least, RSTEST_BENCH_NO_CHECK for none
+        uint32_t           seed;              ///< Seed of the randomized order, 0 for the default
+        TestBenchResult_t *result;            ///< Ratio of the latest execution (may be NULL)
+    } TestBenchAB_t;
+
+    // ------------------------------------------------------------------
+    // Benchmark API
+
+    /// Paired A/B Benchmark test case function (TestCaseParamFunc_t) - see TESTCASE_BENCH_DEF().
+    /// Without a clock in the test suite nothing is measured and the test case fails.
+    /// @param[in] param benchmark definition (TestBenchAB_t)
+    /// @param[in] index unused
+    void rstest_benchAB(const void *param, size_t index);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,162 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork time budgeted, prioritized run.
+/// rstest_runBudget() executes the test cases most likely to catch a
+/// regression first and stops starting test cases once the time budget is
+/// used: the test cases left are reported TestCaseState_Deferred. The
+/// priority of a test case comes from its history, stored results of the
+/// previous runs - its recent failures, whether it changed recently (e.g.
+/// selected by rstest_coverageSelect() for a diff) and its duration.
+///
+/// The priority score of a test case is the sum of
+///  - its recent failures: bit i of failures (i runs ago) scores 2^(7 - i),
+///    the last 8 runs, 255 at most
+///  - RSTEST_BUDGET_SCORE_CHANGED when changed, or not in the history (new).
+/// Test cases execute highest score first, the shortest first between equal
+/// scores. Prerequisites still execute before the test cases depending on them.
+/// @code
+///    static TestHistoryFile_t k_history;
+///    (void)rstest_historyLoad(&k_history, "rstest.history");
+///    (void)rstest_coverageSelect("rstest.coverage", "/dev/stdin", &rstest_historyChanged, &k_history);
+///    rstest_init(&suite); // suite.clockCb = &rstest_hostClockNs
+///    rstest_runBudget(300000000000ULL, &k_history.history); // 5 minutes
+///    rstest_historySave(rstest_getReport(), &k_history.history, "rstest.history");
+/// @endcode
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Max test cases of a test suite executed by rstest_runBudget().
+#if !defined(RSTEST_BUDGET_MAX_CASES)
+#define RSTEST_BUDGET_MAX_CASES (MAX_NUM_TESTCASE_RESULTS)
+#endif
+
+/// Score of a changed (or new) test case.
+#define RSTEST_BUDGET_SCORE_CHANGED (256U)
+
+/// Maximum number of entries of a history file.
+#if !defined(RSTEST_HISTORY_MAX_ENTRIES)
+#define RSTEST_HISTORY_MAX_ENTRIES (64)
+#endif
+
+/// Maximum test case name length of a history file entry (including the null terminator).
+#if !defined(RSTEST_HISTORY_NAME_SIZE)
+#define RSTEST_HISTORY_NAME_SIZE (64)
+#endif
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// History Entry - stored results of a test case.
+    typedef struct TestHistoryEntry_s
+    {
+        const char *name;     ///< TestCase Name
+        uint64_t    duration; ///< Duration of the latest run in clock ticks, 0 when unknown
+        uint32_t    failures; ///< Bit i set when the test case failed i runs ago
+        bool        changed;  ///< The test case (or the code it executes) changed since the latest run
+    } TestHistoryEntry_t;
+
+    /// History of a test suite.
+    typedef struct TestHistory_s
+    {
+        TestHistoryEntry_t *entries; ///< History entries
+        size_t              count;   ///< Count of entries
+    } TestHistory_t;
+
+    /// History loaded from a file.
+    typedef struct TestHistoryFile_s
+    {
+        TestHistory_t      history;                             ///< Loaded history
+        TestHistoryEntry_t entries[RSTEST_HISTORY_MAX_ENTRIES]; ///< Entries
+        char               names[RSTEST_HISTORY_MAX_ENTRIES][RSTEST_HISTORY_NAME_SIZE]; ///< Entry names
+    } TestHistoryFile_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    // ------------------------------------------------------------------
+    // Budget API
+
+    /// Priority score of a test case.
+    /// @param[in] entry history entry of the test case, NULL when not in the history (new)
+    /// @returns the score, higher executes first
+    uint32_t rstest_budgetScore(const TestHistoryEntry_t *entry);
+
+    /// Run the test suite within a time budget, highest priority first.
+    /// A test case starts only when its duration in the history still fits the
+    /// time left (measured with the clockCb of the test suite); the test cases
+    /// not started are TestCaseState_Deferred, counted in the report's
+    /// deferredCount. A run with deferred test cases still passes.
+    /// @param[in] limit time budget in clock ticks of the clockCb
+    /// @param[in] history stored results of the previous runs (may be NULL - every test case is new)
+    /// @retval true when the test suite ran
+    /// @retval false when not initialized, without a clockCb or more than RSTEST_BUDGET_MAX_CASES test cases
+    bool rstest_runBudget(uint64_t limit, const TestHistory_t *history);
+
+#if defined(__unix__) || defined(__APPLE__)
+    // ------------------------------------------------------------------
+    // Host API - history files, one "<test case name> <duration> <failures hex>" per line
+    // ('#' starts a comment line).
+
+    /// Load a history file.
+    /// @param[out] file loaded history (no entry changed)
+    /// @param[in] path history file
+    /// @retval true when loaded
+    /// @retval false when unable to read, malformed or too many entries
+    bool rstest_historyLoad(TestHistoryFile_t *file, const char *path);
+
+    /// Save the results of a report as a history file.
+    /// Test cases not executed (deferred, blocked, disabled) keep their previous history.
+    /// @param[in] report report of a completed test suite
+    /// @param[in] previous history the run was prioritized with (may be NULL)
+    /// @param[in] path history file
+    /// @retval true when saved
+    /// @retval false when unable to write
+    bool rstest_historySave(const TestReport_t *report, const TestHistory_t *previous, const char *path);
+
+    /// Mark a test case of a loaded history changed - a TestCoverageSelectCb_t.
+    /// A test case not in the history is added when there is room.
+    /// @param[in] name name of the test case
+    /// @param[in,out] user TestHistoryFile_t
+    void rstest_historyChanged(const char *name, void *user);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(__cplusplus)
+}
+#endif
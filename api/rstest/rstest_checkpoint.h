@@ -0,0 +1,178 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork checkpoint and resume.
+/// With a checkpoint store set rstest_run() writes its progress - the state
+/// of every test case and the report counters - when a test case starts and
+/// when it completes. After a reset (watchdog, brown-out) rstest_resume()
+/// restores the progress of the interrupted run, so rstest_run() continues
+/// with the test cases that did not complete instead of from the first one.
+/// The test cases executing when the run was interrupted fail.
+/// @code
+///    static TestCheckpoint_t k_checkpoint __attribute__((section(".noinit")));
+///    static const TestCheckpointStore_t k_store = {&rstest_checkpointRamWrite, &rstest_checkpointRamRead,
+///                                                  &k_checkpoint};
+///    rstest_init(&suite);
+///    rstest_setCheckpoint(&k_store);
+///    (void)rstest_resume(); // false - nothing to resume, a new run.
+///    rstest_run();
+/// @endcode
+/// A checkpoint holds RSTEST_CHECKPOINT_MAX_CASES test case states (default
+/// MAX_NUM_TESTCASE_RESULTS, independent of it): with a store set
+/// rstest_run() of a larger test suite returns false without running. Raise it
+/// with a compile definition, e.g. -DRSTEST_CHECKPOINT_MAX_CASES=256.
+///
+/// The store is a pluggable backend: the no-init RAM backend above, the file
+/// backend on a host (rstest_checkpointFileWrite()), or write and read
+/// callbacks erasing and programming a flash sector on a target. Checkpoints
+/// are CRC-32 protected, an erased, torn or corrupt one is not resumed, nor
+/// is one of a different test suite or of a completed run.
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Max test cases of a checkpointed test suite - rstest_run() of a larger one fails.
+#if !defined(RSTEST_CHECKPOINT_MAX_CASES)
+#define RSTEST_CHECKPOINT_MAX_CASES (MAX_NUM_TESTCASE_RESULTS)
+#endif
+
+/// Magic of a written checkpoint ("RSCP").
+#define RSTEST_CHECKPOINT_MAGIC (0x50435352U)
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Report counters of a checkpoint - before the interrupted run.
+    typedef struct TestCheckpointCounters_s
+    {
+        uint32_t testCount;       ///< Total Test cases
+        uint32_t disabledCount;   ///< Total Disabled Test cases
+        uint32_t executedCount;   ///< Total Executed Test cases
+        uint32_t passCount;       ///< Total Passed Test cases
+        uint32_t failCount;       ///< Total Failed Test cases
+        uint32_t blockedCount;    ///< Total Blocked Test cases
+        uint32_t deferredCount;   ///< Total Deferred Test cases
+        uint32_t passAssertCount; ///< Total passing ASSERT_TRUE()
+    } TestCheckpointCounters_t;
+
+    /// Checkpoint - progress of a test suite run, written as is to the store.
+    typedef struct TestCheckpoint_s
+    {
+        uint32_t                 magic;                               ///< RSTEST_CHECKPOINT_MAGIC
+        uint32_t                 suiteHash;                           ///< Hash of the test suite and test case names
+        uint32_t                 caseCount;                           ///< Count of test cases of the test suite
+        uint32_t                 complete;                            ///< Non zero once the run completed
+        TestCheckpointCounters_t base;                                ///< Report counters before the run
+        uint32_t                 passAssert;                          ///< Passing ASSERT_TRUE() of the run so far
+        uint8_t                  states[RSTEST_CHECKPOINT_MAX_CASES]; ///< TestCaseState_t of each test case
+        uint32_t                 crc;                                 ///< CRC-32 of the fields before it
+    } TestCheckpoint_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    /// Checkpoint write callback - persist the checkpoint.
+    /// @param[in] checkpoint checkpoint to write
+    /// @param[in] user user parameter pointer
+    /// @retval true when written
+    typedef bool (*TestCheckpointWriteCb_t)(const TestCheckpoint_t *checkpoint, void *user);
+
+    /// Checkpoint read callback - read the persisted checkpoint (validated by the caller).
+    /// @param[out] checkpoint checkpoint read
+    /// @param[in] user user parameter pointer
+    /// @retval true when read
+    typedef bool (*TestCheckpointReadCb_t)(TestCheckpoint_t *checkpoint, void *user);
+
+    /// Checkpoint store - a persistent storage backend.
+    typedef struct TestCheckpointStore_s
+    {
+        TestCheckpointWriteCb_t writeCb; ///< Write the checkpoint
+        TestCheckpointReadCb_t  readCb;  ///< Read the checkpoint
+        void                   *user;    ///< User pointer for the callbacks
+    } TestCheckpointStore_t;
+
+    // ------------------------------------------------------------------
+    // Checkpoint API
+
+    /// Set the checkpoint store written by rstest_run().
+    /// @param[in] store checkpoint store, NULL to stop checkpointing
+    void rstest_setCheckpoint(const TestCheckpointStore_t *store);
+
+    /// Resume an interrupted run of the initialized test suite from its checkpoint.
+    /// Test cases that completed keep their state and are not executed again,
+    /// test cases that were executing fail. Call between rstest_init() and rstest_run().
+    /// @retval true when resuming - the next rstest_run() continues the interrupted run
+    /// @retval false when there is nothing to resume (no valid checkpoint of this test suite)
+    bool rstest_resume(void);
+
+    /// CRC-32 (IEEE 802.3) of a buffer.
+    /// @param[in] data buffer
+    /// @param[in] size size of the buffer in bytes
+    /// @returns the CRC
+    uint32_t rstest_checkpointCrc(const void *data, size_t size);
+
+    /// No-init RAM backend write - a TestCheckpointWriteCb_t.
+    /// @param[in] checkpoint checkpoint to write
+    /// @param[in] user TestCheckpoint_t in RAM that is not initialized at reset
+    /// @retval true always
+    bool rstest_checkpointRamWrite(const TestCheckpoint_t *checkpoint, void *user);
+
+    /// No-init RAM backend read - a TestCheckpointReadCb_t.
+    /// @param[out] checkpoint checkpoint read
+    /// @param[in] user TestCheckpoint_t in RAM that is not initialized at reset
+    /// @retval true always
+    bool rstest_checkpointRamRead(TestCheckpoint_t *checkpoint, void *user);
+
+    // ------------------------------------------------------------------
+    // Host API
+
+    /// File backend write - a TestCheckpointWriteCb_t, replaces the file atomically.
+    /// @param[in] checkpoint checkpoint to write
+    /// @param[in] user path of the checkpoint file (const char *)
+    /// @retval true when written
+    bool rstest_checkpointFileWrite(const TestCheckpoint_t *checkpoint, void *user);
+
+    /// File backend read - a TestCheckpointReadCb_t.
+    /// @param[out] checkpoint checkpoint read
+    /// @param[in] user path of the checkpoint file (const char *)
+    /// @retval true when read
+    bool rstest_checkpointFileRead(TestCheckpoint_t *checkpoint, void *user);
+
+#if defined(__cplusplus)
+}
+#endif
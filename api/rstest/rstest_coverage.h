@@ -0,0 +1,105 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork per test case coverage maps.
+/// Change based test selection: record the code each test case executes,
+/// then run only the test cases a change touches.
+///
+/// Recording (RSTEST_COVERAGE_MAP, Linux host only): the code under test is
+/// compiled with -fsanitize-coverage=trace-pc-guard (Clang). rstest provides
+/// the guard callbacks and records which guards each test case hits - the
+/// startup callback, the test case and the teardown callback - while
+/// rstest_run() executes. rstest_coverageSave() writes the map: the source
+/// lines of the function of every hit guard and a bitmap of the guards per
+/// test case. A change to any line of a function selects the test cases
+/// executing it.
+///
+/// Selection (host): rstest_coverageSelect() maps the changed lines of a
+/// unified diff (git diff -U0) against the map to the test cases that
+/// executed them. The rstest_select tool prints their names:
+/// @code
+///    git diff -U0 | rstest_select rstest.coverage
+/// @endcode
+/// Test cases that are not in the map (new test cases) are not selected.
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Selected test case callback.
+    /// @param[in] name name of a test case executing changed lines
+    /// @param[in] user user parameter pointer
+    typedef void (*TestCoverageSelectCb_t)(const char *name, void *user);
+
+    // ------------------------------------------------------------------
+    // Selection API
+
+    /// Select the test cases of a coverage map executing lines changed by a diff.
+    /// Changed lines are the old side of the diff hunks - the source the map was recorded with.
+    /// @param[in] mapPath coverage map file (rstest_coverageSave())
+    /// @param[in] diffPath unified diff file (e.g. git diff -U0, "/dev/stdin")
+    /// @param[in] selectCb callback executed once per selected test case
+    /// @param[in] user user pointer for the select callback
+    /// @retval true when selected (possibly none)
+    /// @retval false when unable to read (or no diff file) or a malformed map
+    bool rstest_coverageSelect(const char *mapPath, const char *diffPath, TestCoverageSelectCb_t selectCb,
+                               void *user);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(RSTEST_COVERAGE_MAP)
+    // ------------------------------------------------------------------
+    // Recording API
+
+    /// Count of coverage guards of the instrumented code.
+    /// @returns the count, guards are numbered 1 to count
+    uint32_t rstest_coverageGuardCount(void);
+
+    /// Did a test case hit a guard in its latest execution?
+    /// @param[in] caseIndex index of the test case within the TestSuite
+    /// @param[in] guard guard number
+    /// @retval true when hit
+    /// @retval false otherwise (or beyond MAX_NUM_TESTCASE_RESULTS)
+    bool rstest_coverageHit(size_t caseIndex, uint32_t guard);
+
+    /// Save the coverage map of the test cases of a report.
+    /// Coverage is recorded for the first MAX_NUM_TESTCASE_RESULTS test cases only,
+    /// raise it (compile definition) for larger test suites.
+    /// @param[in] report report of a completed test suite
+    /// @param[in] path coverage map file
+    /// @retval true when saved
+    /// @retval false when unable to write, or the test suite has more than MAX_NUM_TESTCASE_RESULTS test cases
+    bool rstest_coverageSave(const TestReport_t *report, const char *path);
+#endif // defined(RSTEST_COVERAGE_MAP)
+
+#if defined(__cplusplus)
+}
+#endif
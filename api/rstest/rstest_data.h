@@ -0,0 +1,208 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork test data generation.
+/// A seedable pseudo random generator (xoshiro128**) for the input buffers of
+/// test cases, and a cache that keeps generated datasets between the test
+/// cases of a suite so generation is paid once per run instead of in every
+/// startup callback.
+///
+/// The generator runs RSTEST_RANDOM_LANES independent xoshiro128** streams in
+/// lock step, state stored per word across the lanes, so the bulk fills are
+/// plain loops over the lanes the compiler vectorizes (SSE/AVX, NEON, MVE) -
+/// no intrinsics. The output is a sequence of 32 bit words (lane 0 first)
+/// independent of how it is consumed: filling 10 then 30 words gives the same
+/// words as filling 40. Bytes are taken from the words least significant
+/// first, so datasets are the same on every target.
+///
+/// A dataset is described by a TestDataSpec_t - its seed, count and type. The
+/// seed of the latest dataset of a test case is in the dataSeed of its
+/// TestCaseResult_t, to reproduce the input of a failed test case.
+/// @code
+///    static uint8_t              k_pool[16384];
+///    static TestDataCacheEntry_t k_entries[8];
+///    static TestDataCache_t      k_cache = {k_entries, 8U, 0U, k_pool, sizeof(k_pool), 0U};
+///
+///    void RSTC_filter(void)
+///    {
+///        static const TestDataSpec_t k_samples = {TestDataType_Float, 0x5EEDU, 1024U, -1.0, 1.0};
+///        const float *samples = (const float *)rstest_dataGet(&k_cache, &k_samples);
+///        START_TESTCASE();
+///        ASSERT_TRUE(samples != NULL);
+///        ...
+///    }
+/// @endcode
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Count of generator streams in lock step - the words generated at a time.
+#if !defined(RSTEST_RANDOM_LANES)
+#define RSTEST_RANDOM_LANES (8U)
+#endif
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Pseudo random generator - RSTEST_RANDOM_LANES xoshiro128** streams.
+    typedef struct TestRandom_s
+    {
+        uint32_t state[4][RSTEST_RANDOM_LANES]; ///< State word of each lane
+        uint32_t words[RSTEST_RANDOM_LANES];    ///< Words generated, not yet consumed
+        uint32_t next;                          ///< Next word to consume, RSTEST_RANDOM_LANES when none left
+    } TestRandom_t;
+
+    /// Element type of a dataset
+    typedef enum TestDataType_e
+    {
+        TestDataType_Bytes  = 0, ///< uint8_t, whole range
+        TestDataType_U32    = 1, ///< uint32_t, whole range
+        TestDataType_I32    = 2, ///< int32_t within [min, max]
+        TestDataType_Float  = 3, ///< float within [min, max), clamped to the float range
+        TestDataType_Double = 4  ///< double within [min, max)
+    } TestDataType_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Dataset description - the same description generates the same dataset.
+    typedef struct TestDataSpec_s
+    {
+        TestDataType_t type;  ///< Element type
+        uint64_t       seed;  ///< Seed of the generator (non-zero - 0 is no dataset in the result)
+        size_t         count; ///< Count of elements
+        double         min;   ///< Lowest value (I32, Float and Double only)
+        double         max;   ///< Highest value (inclusive for I32, exclusive for Float and Double)
+    } TestDataSpec_t;
+
+    /// Dataset kept by a cache
+    typedef struct TestDataCacheEntry_s
+    {
+        TestDataSpec_t spec; ///< Description of the dataset
+        const void    *data; ///< Dataset within the pool of the cache
+    } TestDataCacheEntry_t;
+
+    /// Dataset cache - datasets are kept in a user provided pool until cleared.
+    typedef struct TestDataCache_s
+    {
+        TestDataCacheEntry_t *entries;  ///< Preallocated entries
+        size_t                capacity; ///< Count of entries
+        size_t                count;    ///< Count of entries used
+        uint8_t              *pool;     ///< Storage of the datasets
+        size_t                poolSize; ///< Size of the pool in bytes
+        size_t                poolUsed; ///< Bytes of the pool used
+    } TestDataCache_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    // ------------------------------------------------------------------
+    // Random API
+
+    /// Seed a generator - every lane from the seed (splitmix64).
+    /// @param[out] rng generator
+    /// @param[in] seed seed, any value
+    void rstest_randomSeed(TestRandom_t *rng, uint64_t seed);
+
+    /// Next word of a generator.
+    /// @param[in,out] rng generator
+    /// @returns the word
+    uint32_t rstest_random32(TestRandom_t *rng);
+
+    /// Fill bytes - whole range.
+    /// @param[in,out] rng generator
+    /// @param[out] values bytes to fill
+    /// @param[in] count count of bytes
+    void rstest_randomBytes(TestRandom_t *rng, uint8_t *values, size_t count);
+
+    /// Fill words - whole range.
+    /// @param[in,out] rng generator
+    /// @param[out] values words to fill
+    /// @param[in] count count of words
+    void rstest_randomU32(TestRandom_t *rng, uint32_t *values, size_t count);
+
+    /// Fill integers within a range - unbiased.
+    /// @param[in,out] rng generator
+    /// @param[out] values integers to fill
+    /// @param[in] count count of integers
+    /// @param[in] min lowest value
+    /// @param[in] max highest value (inclusive), at least min
+    void rstest_randomI32(TestRandom_t *rng, int32_t *values, size_t count, int32_t min, int32_t max);
+
+    /// Fill floats within a range - 24 random bits each.
+    /// @param[in,out] rng generator
+    /// @param[out] values floats to fill
+    /// @param[in] count count of floats
+    /// @param[in] min lowest value
+    /// @param[in] max highest value (exclusive - a draw rounded up to it is drawn again)
+    void rstest_randomFloat(TestRandom_t *rng, float *values, size_t count, float min, float max);
+
+    /// Fill doubles within a range - 53 random bits each.
+    /// @param[in,out] rng generator
+    /// @param[out] values doubles to fill
+    /// @param[in] count count of doubles
+    /// @param[in] min lowest value
+    /// @param[in] max highest value (exclusive - a draw rounded up to it is drawn again)
+    void rstest_randomDouble(TestRandom_t *rng, double *values, size_t count, double min, double max);
+
+    // ------------------------------------------------------------------
+    // Dataset API
+
+    /// Size of a dataset.
+    /// @param[in] spec description of the dataset
+    /// @returns size in bytes, 0 for an unknown type
+    size_t rstest_dataSize(const TestDataSpec_t *spec);
+
+    /// Generate a dataset - the seed is recorded as the dataSeed of the current test case.
+    /// @param[in] spec description of the dataset
+    /// @param[out] data dataset of rstest_dataSize() bytes, aligned for the type
+    /// @retval true when generated
+    /// @retval false for an unknown type or an I32 range with min above max
+    bool rstest_dataFill(const TestDataSpec_t *spec, void *data);
+
+    /// Get a dataset from a cache, generated the first time it is described.
+    /// The seed is recorded as the dataSeed of the current test case.
+    /// @param[in,out] cache dataset cache
+    /// @param[in] spec description of the dataset
+    /// @returns the dataset (shared - copy it to modify), NULL when the cache is full or the spec is invalid
+    const void *rstest_dataGet(TestDataCache_t *cache, const TestDataSpec_t *spec);
+
+    /// Clear a cache - the datasets are generated again when next described.
+    /// @param[in,out] cache dataset cache
+    void rstest_dataCacheClear(TestDataCache_t *cache);
+
+#if defined(__cplusplus)
+}
+#endif
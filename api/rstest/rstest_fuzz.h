@@ -0,0 +1,100 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork fuzzing harness.
+/// Drives the parameterized test cases of a TestSuite (not the benchmark and
+/// stress test cases) from fuzzer generated input, in-process (persistent)
+/// for every input:
+///  - The first input byte selects the parameterized test case (only when
+///    the TestSuite has more than one enabled parameterized test case).
+///  - The remaining bytes are the parameter (truncated or zero padded to
+///    the paramSize of the test case).
+///  - Startup and teardown callbacks are executed around every input.
+///  - Any failure (ASSERT_TRUE(false), END_TESTCASE_FAIL() or not ending the
+///    test case) aborts so the fuzzer records it as a crash.
+///
+/// The rstest_fuzz library provides LLVMFuzzerInitialize() and
+/// LLVMFuzzerTestOneInput() for libFuzzer; the fuzz target only defines
+/// rstest_fuzzTestSuite().
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Maximum number of parameterized test cases selectable by the fuzzer.
+#if !defined(RSTEST_FUZZ_MAX_CASES)
+#define RSTEST_FUZZ_MAX_CASES (32)
+#endif
+
+/// Maximum paramSize of a fuzzed parameterized test case.
+#if !defined(RSTEST_FUZZ_MAX_PARAM_SIZE)
+#define RSTEST_FUZZ_MAX_PARAM_SIZE (4096)
+#endif
+
+    // ------------------------------------------------------------------
+    // Fuzz target API
+
+    /// Test Suite to fuzz - defined by the fuzz target.
+    /// @returns the TestSuite containing the parameterized test cases to fuzz.
+    const TestSuite_t *rstest_fuzzTestSuite(void);
+
+    // ------------------------------------------------------------------
+    // Harness API
+
+    /// Initialize the fuzzing harness with a TestSuite.
+    /// @param[in] testSuite the test suite to fuzz
+    /// @retval true if initialized (valid suite with at least one enabled parameterized test case
+    ///     with a paramSize of at most RSTEST_FUZZ_MAX_PARAM_SIZE)
+    /// @retval false otherwise
+    bool rstest_fuzzInit(const TestSuite_t *testSuite);
+
+    /// Execute one fuzz input.
+    /// @param[in] data fuzz input
+    /// @param[in] size size of the fuzz input
+    /// @returns 0 (failures abort)
+    /// @pre rstest_fuzzInit() succeeded.
+    int rstest_fuzzOne(const uint8_t *data, size_t size);
+
+    /// libFuzzer initialization - initializes with rstest_fuzzTestSuite().
+    /// @param[in] argc argument count
+    /// @param[in] argv arguments
+    /// @returns 0
+    int LLVMFuzzerInitialize(int *argc, char ***argv);
+
+    /// libFuzzer entry point - see rstest_fuzzOne().
+    /// @param[in] data fuzz input
+    /// @param[in] size size of the fuzz input
+    /// @returns 0
+    int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,143 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork golden file comparison (host only).
+/// Compares test case output with a reference (golden) file mapped read-only,
+/// without reading it into heap buffers:
+/// @code
+///    ASSERT_MATCHES_FILE(output, outputLen, "vectors/decode_ref.bin");
+/// @endcode
+/// Output produced in chunks is compared as it is produced:
+/// @code
+///    TestGolden_t golden;
+///    ASSERT_MATCHES_FILE_OPEN(&golden, "vectors/decode_ref.bin");
+///    while (decodeFrame(frame, &frameLen))
+///    {
+///        ASSERT_MATCHES_FILE_CHUNK(&golden, frame, frameLen);
+///    }
+///    ASSERT_MATCHES_FILE_CLOSE(&golden);
+/// @endcode
+/// A mismatch fails a single assertion, rstest_goldenMismatchOffset() is the
+/// offset of the first differing byte. With rstest_goldenWriteActual() the
+/// actual output is written to "<golden file>.actual" for diffing.
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+/// No mismatch - rstest_goldenMismatchOffset() before any mismatch.
+#define RSTEST_GOLDEN_NO_MISMATCH (SIZE_MAX)
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Golden file compared in chunks.
+    typedef struct TestGolden_s
+    {
+        const char    *path;     ///< Golden file
+        const uint8_t *data;     ///< Golden file mapped read-only (NULL when empty or not mapped)
+        size_t         size;     ///< Size of the golden file
+        size_t         offset;   ///< Count of output bytes compared
+        void          *actual;   ///< Actual output file written after a mismatch (FILE, NULL if none)
+        bool           mismatch; ///< A mismatch was reported - later chunks are not compared
+    } TestGolden_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Defines helpers for test cases
+
+/// Assert a buffer matches a golden file - contents and length.
+/// @param[in] buf output to compare
+/// @param[in] len length of the output in bytes
+/// @param[in] path golden file
+#define ASSERT_MATCHES_FILE(buf, len, path) ASSERT_TRUE(rstest_goldenMatch((buf), (len), (path)))
+
+/// Assert a golden file is mapped to compare output in chunks.
+/// @param[out] golden TestGolden_t of the comparison
+/// @param[in] path golden file
+#define ASSERT_MATCHES_FILE_OPEN(golden, path) ASSERT_TRUE(rstest_goldenOpen((golden), (path)))
+
+/// Assert the next chunk of output matches the golden file.
+/// @param[in,out] golden TestGolden_t of the comparison
+/// @param[in] buf chunk of output to compare
+/// @param[in] len length of the chunk in bytes
+#define ASSERT_MATCHES_FILE_CHUNK(golden, buf, len) ASSERT_TRUE(rstest_goldenChunk((golden), (buf), (len)))
+
+/// Assert the output compared in chunks is the length of the golden file and unmap it.
+/// @param[in,out] golden TestGolden_t of the comparison
+#define ASSERT_MATCHES_FILE_CLOSE(golden) ASSERT_TRUE(rstest_goldenClose(golden))
+
+    // ------------------------------------------------------------------
+    // Host API
+
+    /// Write the actual output to "<golden file>.actual" when it does not match.
+    /// @param[in] enable true to write the actual output
+    void rstest_goldenWriteActual(bool enable);
+
+    /// Offset of the first differing byte of the latest mismatch.
+    /// A length mismatch is at the end of the shorter of the output and the golden file.
+    /// @returns the offset, RSTEST_GOLDEN_NO_MISMATCH if there was none
+    size_t rstest_goldenMismatchOffset(void);
+
+    /// Compare a buffer with a golden file - contents and length.
+    /// @param[in] buf output to compare
+    /// @param[in] len length of the output in bytes
+    /// @param[in] path golden file
+    /// @retval true when they match
+    /// @retval false when they do not or unable to map the golden file
+    bool rstest_goldenMatch(const void *buf, size_t len, const char *path);
+
+    /// Map a golden file to compare output in chunks.
+    /// @param[out] golden comparison
+    /// @param[in] path golden file
+    /// @retval true when mapped
+    /// @retval false when unable to map (later chunks and close are not compared)
+    bool rstest_goldenOpen(TestGolden_t *golden, const char *path);
+
+    /// Compare the next chunk of output with the golden file.
+    /// @param[in,out] golden comparison
+    /// @param[in] buf chunk of output to compare
+    /// @param[in] len length of the chunk in bytes
+    /// @retval true when it matches, or a mismatch was already reported
+    /// @retval false on the first mismatch
+    bool rstest_goldenChunk(TestGolden_t *golden, const void *buf, size_t len);
+
+    /// Complete the comparison - the output must be the length of the golden file - and unmap it.
+    /// @param[in,out] golden comparison
+    /// @retval true when the lengths match, or a mismatch was already reported
+    /// @retval false on a length mismatch
+    bool rstest_goldenClose(TestGolden_t *golden);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,119 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork heap usage instrumentation.
+/// Tracks allocations performed while a test case (startup, test case and
+/// teardown) is executing when built with RSTEST_HEAP_TRACKING.
+///
+/// On embedded targets either allocate through rstest_malloc() and friends or
+/// hook the platform allocator with rstest_heapOnAlloc() / rstest_heapOnFree().
+/// On host builds with RSTEST_HEAP_WRAP the C allocator is interposed at link
+/// time (-Wl,--wrap=malloc ...) so no change to the code under test is needed.
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest_std_macros.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Maximum number of live allocations tracked at once per test case.
+/// Allocations beyond this are counted but cannot be matched on free.
+#if !defined(RSTEST_HEAP_MAX_TRACKED)
+#define RSTEST_HEAP_MAX_TRACKED (256)
+#endif
+
+/// Heap limit value for no limit.
+#define RSTEST_HEAP_UNLIMITED (SIZE_MAX)
+
+/// Default Heap Limits initializer - no limits other than no leaks allowed.
+#define RSTEST_HEAP_LIMITS_DEFAULT                                                 \
+    {                                                                              \
+        RSTEST_HEAP_UNLIMITED, RSTEST_HEAP_UNLIMITED, RSTEST_HEAP_UNLIMITED, 0U    \
+    }
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Heap Statistics of a single test case execution
+    typedef struct TestHeapStats_s
+    {
+        size_t allocCount;     ///< Number of allocations
+        size_t freeCount;      ///< Number of frees of allocations made within the test case
+        size_t allocBytes;     ///< Total bytes allocated
+        size_t peakBytes;      ///< Peak live bytes
+        size_t leakedBytes;    ///< Bytes still allocated after teardown
+        size_t untrackedCount; ///< Allocations that could not be tracked (RSTEST_HEAP_MAX_TRACKED exceeded)
+    } TestHeapStats_t;
+
+    /// Heap Limits - exceeding any of these fails the test case.
+    /// Use RSTEST_HEAP_UNLIMITED to disable a limit.
+    typedef struct TestHeapLimits_s
+    {
+        size_t maxAllocCount;  ///< Maximum number of allocations
+        size_t maxAllocBytes;  ///< Maximum total bytes allocated
+        size_t maxPeakBytes;   ///< Maximum peak live bytes
+        size_t maxLeakedBytes; ///< Maximum bytes leaked after teardown
+    } TestHeapLimits_t;
+
+    // ------------------------------------------------------------------
+    // Allocation API
+
+    /// Allocate memory and track it against the current test case.
+    /// @param[in] size number of bytes
+    /// @returns pointer to allocated memory or NULL
+    void *rstest_malloc(size_t size);
+
+    /// Allocate zeroed memory and track it against the current test case.
+    /// @param[in] num number of elements
+    /// @param[in] size size of each element
+    /// @returns pointer to allocated memory or NULL
+    void *rstest_calloc(size_t num, size_t size);
+
+    /// Reallocate memory and track it against the current test case.
+    /// @param[in] ptr previously allocated memory (or NULL)
+    /// @param[in] size new number of bytes
+    /// @returns pointer to allocated memory or NULL
+    void *rstest_realloc(void *ptr, size_t size);
+
+    /// Free memory and track it against the current test case.
+    /// @param[in] ptr previously allocated memory (or NULL)
+    void rstest_free(void *ptr);
+
+    /// Allocation hook for platform allocators.
+    /// @param[in] ptr allocated memory (NULL is ignored)
+    /// @param[in] size number of bytes allocated
+    void rstest_heapOnAlloc(const void *ptr, size_t size);
+
+    /// Free hook for platform allocators.
+    /// @param[in] ptr memory being freed (NULL is ignored)
+    void rstest_heapOnFree(const void *ptr);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,152 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork deferred binary logging.
+/// RSTEST_LOG() records a message of the executing test case without
+/// formatting it: only the format string pointer and the raw argument words
+/// are stored into a preallocated ring buffer, a few stores per message. The
+/// ring buffer is discarded as each test case starts, when a test case fails
+/// its messages are kept in the failure entries of the log to emit with the
+/// failure report. The messages are formatted on a host by
+/// rstest_logFormat() / rstest_logExport() - a target sends the entries with
+/// its image, the format strings are read from the image.
+///
+/// Arguments are integers, characters or pointers no wider than uintptr_t
+/// (%s strings must outlive the test suite - e.g. string literals), at most
+/// RSTEST_LOG_MAX_ARGS per message. Floating point arguments are not supported.
+/// @code
+///    static TestLogEntry_t k_entries[64];
+///    static TestLogEntry_t k_failEntries[256];
+///    static TestLog_t      k_log = {k_entries, 64U, 0U, k_failEntries, 256U, 0U};
+///    rstest_setLog(&k_log);
+///
+///    void RSTC_transfer(void)
+///    {
+///        START_TESTCASE();
+///        RSTEST_LOG("sent %u bytes, status 0x%02x", len, status);
+///        ...
+///    }
+/// @endcode
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Maximum count of arguments of a RSTEST_LOG() message.
+#define RSTEST_LOG_MAX_ARGS (4U)
+
+/// Test case index of a message logged outside of a test case.
+#define RSTEST_LOG_NO_CASE (UINT32_MAX)
+
+/// Log a message of the executing test case - formatted on a host only on failure.
+/// @param[in] ... printf style format string literal followed by up to RSTEST_LOG_MAX_ARGS arguments
+#define RSTEST_LOG(...) RSTEST_LOG_(__VA_ARGS__, 0, 0, 0, 0, 0)
+
+/// Pads the arguments of RSTEST_LOG() to RSTEST_LOG_MAX_ARGS words (internal).
+#define RSTEST_LOG_(fmt, a0, a1, a2, a3, ...) \
+    rstest_log((fmt), (uintptr_t)(a0), (uintptr_t)(a1), (uintptr_t)(a2), (uintptr_t)(a3))
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Log entry - a message not yet formatted
+    typedef struct TestLogEntry_s
+    {
+        const char *fmt;                       ///< printf style format string
+        uintptr_t   args[RSTEST_LOG_MAX_ARGS]; ///< Raw argument words
+        uint32_t    caseIndex;                 ///< Index of the test case that logged it
+    } TestLogEntry_t;
+
+    /// Log of the test cases
+    typedef struct TestLog_s
+    {
+        TestLogEntry_t *entries;      ///< Preallocated ring buffer of the executing test case
+        uint32_t        capacity;     ///< Count of entries, a power of 2
+        uint32_t        head;         ///< Count of entries logged, the latest capacity are kept
+        TestLogEntry_t *failEntries;  ///< Preallocated entries kept of the failed test cases
+        uint32_t        failCapacity; ///< Count of failEntries
+        uint32_t        failCount;    ///< Count of entries of the failed test cases, at most failCapacity are kept
+    } TestLog_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    // ------------------------------------------------------------------
+    // Log API
+
+    /// Set the log RSTEST_LOG() records into.
+    /// Clears the entries and the failure entries of the log.
+    /// @param[in,out] log log, NULL to stop logging.
+    /// @retval true when set
+    /// @retval false when the capacity is not a power of 2 (nothing is logged)
+    bool rstest_setLog(TestLog_t *log);
+
+    /// Log a message of the executing test case (see RSTEST_LOG()).
+    /// Nothing is logged outside of a test case.
+    /// @param[in] fmt printf style format string
+    /// @param[in] a0 first argument word
+    /// @param[in] a1 second argument word
+    /// @param[in] a2 third argument word
+    /// @param[in] a3 fourth argument word
+    void rstest_log(const char *fmt, uintptr_t a0, uintptr_t a1, uintptr_t a2, uintptr_t a3);
+
+    /// Count of failure entries kept in a log.
+    /// @param[in] log log
+    /// @returns the count, at most failCapacity
+    uint32_t rstest_logFailCount(const TestLog_t *log);
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// Format a log entry (host only).
+    /// The format string and %s arguments must be addressable by the host.
+    /// @param[in] entry log entry
+    /// @param[out] buf buffer for the message, always terminated
+    /// @param[in] size size of buf
+    /// @returns the length of the message (as snprintf(), may exceed size)
+    size_t rstest_logFormat(const TestLogEntry_t *entry, char *buf, size_t size);
+
+    /// Export the failure entries of a log as text, a line per message (host only).
+    /// @param[in] log log
+    /// @param[in] testSuite test suite the test case indices belong to (names the test cases)
+    /// @param[in] path file to write
+    /// @retval true when written
+    /// @retval false when unable to write
+    bool rstest_logExport(const TestLog_t *log, const TestSuite_t *testSuite, const char *path);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,81 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork hardware performance counters.
+/// Counts hardware events (cycles, instructions, cache and branch misses)
+/// while the body of each test case executes when built with
+/// RSTEST_PERF_COUNTERS - Linux hosts only (perf_event_open), excluded from
+/// embedded builds at compile time. Counters the kernel does not provide (a
+/// container, a virtual machine, perf_event_paranoid) are reported invalid
+/// and their limits are not checked.
+//
+#pragma once
+
+#include <stdint.h>
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Performance limit value for no limit.
+#define RSTEST_PERF_UNLIMITED (0U)
+
+/// Count of performance counters (TestPerfCounter_t)
+#define RSTEST_PERF_COUNTER_COUNT (6U)
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Performance counter
+    typedef enum TestPerfCounter_e
+    {
+        TestPerfCounter_Cycles             = 0, ///< CPU cycles
+        TestPerfCounter_Instructions       = 1, ///< Retired instructions
+        TestPerfCounter_CacheReferences    = 2, ///< Last level cache references
+        TestPerfCounter_CacheMisses        = 3, ///< Last level cache misses
+        TestPerfCounter_BranchInstructions = 4, ///< Retired branch instructions
+        TestPerfCounter_BranchMisses       = 5  ///< Mispredicted branch instructions
+    } TestPerfCounter_t;
+
+    /// Performance counts of a single test case execution.
+    typedef struct TestPerfStats_s
+    {
+        uint64_t counts[RSTEST_PERF_COUNTER_COUNT]; ///< Counts indexed by TestPerfCounter_t
+        uint32_t valid;                             ///< Bit (1 << TestPerfCounter_t) set for each counted counter
+    } TestPerfStats_t;
+
+    /// Performance Limits - exceeding any of these fails the test case.
+    /// Ratios are in permille, RSTEST_PERF_UNLIMITED to disable a limit.
+    typedef struct TestPerfLimits_s
+    {
+        uint32_t minIpcPermille;        ///< Minimum instructions per 1000 cycles
+        uint32_t maxCacheMissPermille;  ///< Maximum cache misses per 1000 cache references
+        uint32_t maxBranchMissPermille; ///< Maximum branch misses per 1000 branch instructions
+        uint64_t maxCycles;             ///< Maximum cycles
+    } TestPerfLimits_t;
+
+#if defined(__cplusplus)
+}
+#endif
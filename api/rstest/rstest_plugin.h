@@ -0,0 +1,156 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork test suite plugins (host only).
+/// Test suites built as shared objects and loaded by a runner, so changing a
+/// test suite rebuilds its plugin only instead of relinking one executable
+/// with every test suite. A plugin exports its test suites with
+/// RSTEST_PLUGIN_EXPORT() and does not link rstest: the framework is resolved
+/// from the runner that loads it (rstest_plugin, linked with the whole of
+/// rstest and its symbols exported).
+/// @code
+///    static TestCase_t        k_cases[] = {TESTCASE_DEF(TC_Parse, TestCaseState_Idle)};
+///    static TestSuite_t       k_suite   = {.name = "Parser", .testCases = k_cases, .count = ARRAY_SIZE(k_cases)};
+///    static const TestSuite_t *const k_suites[] = {&k_suite};
+///    RSTEST_PLUGIN_EXPORT(k_suites);
+/// @endcode
+/// Run the plugins with a merged report:
+///     rstest_plugin libparser_tests.so libqueue_tests.so
+//
+#pragma once
+
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Version of TestPlugin_t - a plugin of another version is not loaded.
+#define RSTEST_PLUGIN_VERSION (1U)
+
+/// Name of the TestPlugin_t a plugin exports.
+#define RSTEST_PLUGIN_SYMBOL "rstest_plugin"
+
+/// Export the symbol from the shared object.
+#if defined(__GNUC__) || defined(__clang__)
+#define RSTEST_PLUGIN_VISIBLE __attribute__((visibility("default")))
+#else
+#define RSTEST_PLUGIN_VISIBLE
+#endif
+
+/// Declare the symbol with external C linkage (a const object has internal linkage in C++).
+#if defined(__cplusplus)
+#define RSTEST_PLUGIN_EXTERN extern "C"
+#else
+#define RSTEST_PLUGIN_EXTERN extern
+#endif
+
+/// Export the test suites of a plugin - once in the shared object (C or C++).
+/// @param[in] suites array of const TestSuite_t pointers (not a pointer to it)
+#define RSTEST_PLUGIN_EXPORT(suites)                                             \
+    RSTEST_PLUGIN_EXTERN RSTEST_PLUGIN_VISIBLE const TestPlugin_t rstest_plugin; \
+    const TestPlugin_t rstest_plugin = {RSTEST_PLUGIN_VERSION, (uint32_t)ARRAY_SIZE(suites), &((suites)[0])}
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Test suites exported by a plugin (RSTEST_PLUGIN_SYMBOL).
+    typedef struct TestPlugin_s
+    {
+        uint32_t                  version; ///< RSTEST_PLUGIN_VERSION the plugin was built with
+        uint32_t                  count;   ///< Count of test suites
+        const TestSuite_t *const *suites;  ///< Test suites of the plugin
+    } TestPlugin_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    /// Report merged over the test suites of the plugins run - zero initialize before the first run.
+    typedef struct TestPluginReport_s
+    {
+        uint32_t pluginCount;     ///< Plugins loaded
+        uint32_t loadFailCount;   ///< Plugins that could not be loaded
+        uint32_t suiteCount;      ///< Test suites run
+        uint32_t suiteFailCount;  ///< Test suites that did not pass (or could not be initialized)
+        uint32_t testCount;       ///< Total Test cases
+        uint32_t disabledCount;   ///< Total Disabled Test cases
+        uint32_t executedCount;   ///< Total Executed Test cases
+        uint32_t passCount;       ///< Total Passed Test cases
+        uint32_t failCount;       ///< Total Failed Test cases
+        uint32_t blockedCount;    ///< Total Blocked Test cases
+        uint32_t deferredCount;   ///< Total Deferred Test cases
+        uint32_t passAssertCount; ///< Total passing ASSERT_TRUE()
+    } TestPluginReport_t;
+
+    /// Plugin Suite Callback function - a test suite of a plugin completed.
+    /// The test suite, the report and the entries of the trace and log refer to the
+    /// plugin: read or export them (rstest_traceExport(), rstest_logExport()) during
+    /// the callback. The trace and log entries are discarded after it.
+    /// @param[in] path path of the plugin
+    /// @param[in] testSuite test suite of the plugin
+    /// @param[in] report report of the test suite, NULL when it could not be initialized
+    /// @param[in] user user parameter pointer
+    typedef void (*TestPluginSuiteCb_t)(const char *path, const TestSuite_t *testSuite, const TestReport_t *report,
+                                        void *user);
+
+    // ------------------------------------------------------------------
+    // Plugin API
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// Load a plugin, run each of its test suites and merge the reports (host only).
+    /// The plugin is unloaded after the run, so a rebuilt plugin is loaded again by the next run.
+    /// Nothing refers to it afterwards: the test suite is released (rstest_getReport() is NULL
+    /// until the next rstest_init()) and the trace and log entries of its test suites are discarded.
+    /// @param[in] path path of the shared object
+    /// @param[in,out] merged report merged into
+    /// @param[in] suiteCb callback after each test suite (may be NULL)
+    /// @param[in] user user pointer for the callback
+    /// @retval true when loaded and run (its test suites may fail)
+    /// @retval false when not loaded - no shared object, no RSTEST_PLUGIN_SYMBOL or another version
+    bool rstest_pluginRun(const char *path, TestPluginReport_t *merged, TestPluginSuiteCb_t suiteCb, void *user);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+    /// Merge the report of a test suite.
+    /// @param[in,out] merged report merged into
+    /// @param[in] report report of the test suite, NULL when it could not be initialized
+    /// @param[in] passed the test suite passed (rstest_testSuitePassed())
+    void rstest_pluginMerge(TestPluginReport_t *merged, const TestReport_t *report, bool passed);
+
+    /// Did every plugin load and every test suite pass.
+    /// @param[in] merged merged report
+    /// @retval true when at least a test suite ran and all passed
+    /// @retval false otherwise
+    bool rstest_pluginPassed(const TestPluginReport_t *merged);
+
+#if defined(__cplusplus)
+}
+#endif
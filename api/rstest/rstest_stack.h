@@ -0,0 +1,120 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork stack usage measurement.
+/// Executes each test case (startup, test case and teardown) on a stack
+/// region of its own when built with RSTEST_STACK_USAGE. The region is painted
+/// with RSTEST_STACK_PAINT before the test case, afterwards the deepest word
+/// no longer holding the paint is the high-water mark of the stack. Stacks are
+/// assumed to grow down (ARM, RISC-V, x86).
+///
+/// Switching to the region is platform specific - the runCb of the TestStack_t
+/// executes a function on it: rstest_stackRunHost() on a host (ucontext), a
+/// few instructions setting the stack pointer on a target. Async test cases
+/// execute on the stack of rstest_run() and are not measured.
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest_std_macros.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Pattern painted on the stack region before each test case.
+#define RSTEST_STACK_PAINT (0xA5A5A5A5U)
+
+/// Bytes at the low end of the stack region that count as an overflow when written.
+/// Frames have padding the test case may not write, so reaching near the end is an overflow too.
+#if !defined(RSTEST_STACK_GUARD)
+#define RSTEST_STACK_GUARD (32U)
+#endif
+
+/// Stack limit value for no limit.
+#define RSTEST_STACK_UNLIMITED (SIZE_MAX)
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Function executed on a stack region.
+    /// @param[in] arg argument of the function
+    typedef void (*TestStackFunc_t)(void *arg);
+
+    /// Stack Run Callback function - execute a function on a stack region and return when it returns.
+    /// @param[in] stack lowest address of the stack region
+    /// @param[in] size size of the stack region in bytes
+    /// @param[in] func function to execute
+    /// @param[in] arg argument of the function
+    /// @param[in] user user parameter pointer
+    typedef void (*TestStackRunCb_t)(void *stack, size_t size, TestStackFunc_t func, void *arg, void *user);
+
+    /// Stack Usage of a single test case execution
+    typedef struct TestStackStats_s
+    {
+        size_t usedBytes; ///< High-water mark of the stack in bytes
+        size_t sizeBytes; ///< Size of the stack region, 0 when not executed on a stack region
+    } TestStackStats_t;
+
+    /// Stack the test cases execute on - exceeding maxUsedBytes fails the test case.
+    /// Writing the lowest RSTEST_STACK_GUARD bytes of the region (an overflow) always fails the test case.
+    typedef struct TestStack_s
+    {
+        void            *region;       ///< Lowest address of the stack region
+        size_t           size;         ///< Size of the stack region in bytes
+        size_t           maxUsedBytes; ///< Maximum stack usage in bytes, RSTEST_STACK_UNLIMITED for no limit
+        TestStackRunCb_t runCb;        ///< Executes a function on the region (e.g. rstest_stackRunHost)
+        void            *runCbUser;    ///< User pointer for run callback
+    } TestStack_t;
+
+    // ------------------------------------------------------------------
+    // Stack API
+
+    /// Paint a stack region with RSTEST_STACK_PAINT (whole aligned words).
+    /// @param[out] region lowest address of the stack region
+    /// @param[in] size size of the stack region in bytes
+    void rstest_stackPaint(void *region, size_t size);
+
+    /// High-water mark of a painted stack region.
+    /// @param[in] region lowest address of the stack region
+    /// @param[in] size size of the stack region in bytes
+    /// @returns bytes from the deepest word no longer painted to the top of the (aligned) region
+    size_t rstest_stackUsed(const void *region, size_t size);
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// Stack Run Callback of a host - executes the function on the region with ucontext (host only).
+    /// The region must also hold the frames of the C library called by the test case (e.g. 64 KiB).
+    /// @param[in] stack lowest address of the stack region
+    /// @param[in] size size of the stack region in bytes
+    /// @param[in] func function to execute
+    /// @param[in] arg argument of the function
+    /// @param[in] user unused
+    void rstest_stackRunHost(void *stack, size_t size, TestStackFunc_t func, void *arg, void *user);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,123 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork live status block.
+/// A status block updated by rstest_run() while the test suite executes so
+/// the progress can be observed without halting the target: the current test
+/// case, the count of test cases per state and the latest failure.
+///
+/// The block holds no pointers so it can be placed in memory shared with
+/// another process or debug probe: a static, a fixed RAM address (linker
+/// section) on a target or a memory mapped file on a host
+/// (rstest_statusMapFile()). Updates use seqlock semantics - the sequence is
+/// odd while the block is being updated, readers retry until they copy the
+/// block with the same even sequence before and after (rstest_statusRead()).
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Status block magic ('RSTS')
+#define RSTEST_STATUS_MAGIC (0x52535453U)
+
+/// Status block layout version
+#define RSTEST_STATUS_VERSION (3U)
+
+/// Size of the names copied into the status block (including the null terminator).
+#if !defined(RSTEST_STATUS_NAME_SIZE)
+#define RSTEST_STATUS_NAME_SIZE (32U)
+#endif
+
+/// Count of TestCaseState_t values
+#define RSTEST_STATUS_STATE_COUNT (7U)
+
+/// Test case index of the status block before any test case executed.
+#define RSTEST_STATUS_NO_CASE (UINT32_MAX)
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Status block failure record - AssertRecord_t without pointers.
+    typedef struct TestStatusFailure_s
+    {
+        uint32_t caseIndex;                     ///< Index of the failing test case
+        uint32_t line;                          ///< Line number
+        uint32_t param;                         ///< Parameter index (RSTEST_NO_PARAM when not parameterized)
+        char     file[RSTEST_STATUS_NAME_SIZE]; ///< File name (truncated)
+    } TestStatusFailure_t;
+
+    /// Live status block of the test suite.
+    typedef struct TestStatus_s
+    {
+        uint32_t            magic;                                 ///< RSTEST_STATUS_MAGIC once initialized
+        uint32_t            version;                               ///< RSTEST_STATUS_VERSION
+        volatile uint32_t   sequence;                              ///< Seqlock sequence, odd while updating
+        uint32_t            running;                               ///< 1 while rstest_run() is executing
+        uint32_t            runCount;                              ///< Count of completed rstest_run()
+        uint32_t            caseCount;                             ///< Count of test cases of the test suite
+        uint32_t            caseIndex;                             ///< Index of the latest started/completed test case
+        uint32_t            stateCount[RSTEST_STATUS_STATE_COUNT]; ///< Count of test cases per TestCaseState_t
+        uint32_t            failAssertCount;                       ///< Count of failing assertions
+        TestStatusFailure_t lastFailure;                           ///< Latest failing assertion
+        char                suiteName[RSTEST_STATUS_NAME_SIZE];    ///< TestSuite name (truncated)
+        char                caseName[RSTEST_STATUS_NAME_SIZE];     ///< Name of caseIndex test case (truncated)
+    } TestStatus_t;
+
+    // ------------------------------------------------------------------
+    // Status API
+
+    /// Set the status block updated by rstest_run().
+    /// Initializes the block (magic, version, cleared counters).
+    /// @param[out] status status block, NULL to stop updating a status block.
+    void rstest_setStatus(TestStatus_t *status);
+
+    /// Read a consistent copy of a status block (seqlock read).
+    /// @param[in] status status block, possibly updated concurrently
+    /// @param[out] copy consistent copy of the status block
+    /// @retval true when copied
+    /// @retval false when not initialized or no consistent copy after several retries
+    bool rstest_statusRead(const TestStatus_t *status, TestStatus_t *copy);
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// Map a status block file (host only).
+    /// @param[in] path file of the status block
+    /// @param[in] create true to create/resize the file for writing
+    /// @returns the mapped status block, NULL on failure.
+    TestStatus_t *rstest_statusMapFile(const char *path, bool create);
+
+    /// Unmap a status block mapped with rstest_statusMapFile().
+    /// @param[in] status mapped status block (NULL is ignored)
+    void rstest_statusUnmapFile(TestStatus_t *status);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(__cplusplus)
+}
+#endif
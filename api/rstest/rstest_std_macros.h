@@ -44,6 +44,25 @@ typedef int bool;
 
 #define ARRAY_SIZE(arr) (sizeof(arr) / sizeof((arr)[0]))
 
+/// Intentional switch case fall through (within macros comments cannot be used).
+#if defined(__GNUC__) || defined(__clang__)
+#define RSTEST_FALLTHROUGH __attribute__((fallthrough))
+#else
+#define RSTEST_FALLTHROUGH
+#endif
+
+/// Branch prediction hints - the condition is expected to be true / false.
+/// Out of line, rarely executed function (e.g. failure handling).
+#if defined(__GNUC__) || defined(__clang__)
+#define RSTEST_LIKELY(cond)   __builtin_expect(!!(cond), 1)
+#define RSTEST_UNLIKELY(cond) __builtin_expect(!!(cond), 0)
+#define RSTEST_COLD           __attribute__((cold, noinline))
+#else
+#define RSTEST_LIKELY(cond)   (cond)
+#define RSTEST_UNLIKELY(cond) (cond)
+#define RSTEST_COLD
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
 static const int PATH_DELIMITER = '/';
 #else
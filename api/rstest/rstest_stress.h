@@ -0,0 +1,158 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork concurrency stress test cases.
+/// Executes the body of a test case on several threads at once to shake out
+/// races (e.g. in lock-free queues) and measure the throughput achieved. The
+/// threads wait on a spin barrier so they start the iterations together, then
+/// each executes the body for every iteration with its own thread index.
+///
+/// Starting threads is platform specific - the runner set by
+/// rstest_setStressRunner() executes a worker on each thread and returns when
+/// all of them returned: rstest_stressRunHost() on a host (pthreads), tasks
+/// of an RTOS on a target. The body may use ASSERT_TRUE() on any thread:
+/// while the threads execute passing assertions are counted atomically and
+/// failures are recorded one at a time, as are ASSERT_COMPLETES_WITHIN()
+/// timings and tracked allocations (RSTEST_HEAP_TRACKING). The failure
+/// callback executes on the failing thread, after the failure is recorded.
+/// @code
+///    static void TC_QueuePushPop(uint32_t thread, uint32_t iteration, void *user)
+///    {
+///        ASSERT_TRUE(queue_push(&k_queue, thread));
+///        ASSERT_TRUE(queue_pop(&k_queue) != QUEUE_EMPTY);
+///    }
+///    static TestStressResult_t k_queueRate;
+///    static const TestStress_t k_queueStress = {&TC_QueuePushPop, NULL, 8U, 100000U, 1000000000U, NULL, &k_queueRate};
+///    TestCase_t k_TestCases[] = {
+///         TESTCASE_STRESS_DEF(TC_Queue, k_queueStress, TestCaseState_Idle),
+///    };
+///    rstest_setStressRunner(&rstest_stressRunHost, NULL);
+/// @endcode
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest_std_macros.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Maximum count of threads of a stress test case.
+#if !defined(RSTEST_STRESS_MAX_THREADS)
+#define RSTEST_STRESS_MAX_THREADS (16U)
+#endif
+
+/// Concurrency Stress Test Case Define
+/// The test case fails when the body fails on any thread, or the threads cannot be started.
+/// @param[in] name name of the test case
+/// @param[in] stress stress definition (TestStress_t object, not a copy)
+/// @param[in] state initial TestCaseState_t of the testcase, can only be Idle, Disabled
+#define TESTCASE_STRESS_DEF(name, stress, state)                                                  \
+    {                                                                                             \
+        (#name), NULL, (state), &rstest_stressCase, &(stress), 1U, sizeof(stress), NULL, NULL, 0U \
+    }
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Body of a stress test case - executed for every iteration on every thread.
+    /// @param[in] thread index of the thread (0 .. threads - 1)
+    /// @param[in] iteration index of the iteration on the thread
+    /// @param[in] user user parameter pointer
+    typedef void (*TestStressFunc_t)(uint32_t thread, uint32_t iteration, void *user);
+
+    /// Worker executed by each thread of a stress runner.
+    /// @param[in] thread index of the thread
+    /// @param[in] arg argument of the worker
+    typedef void (*TestStressWorker_t)(uint32_t thread, void *arg);
+
+    /// Stress Runner Callback function - execute a worker on each of the threads concurrently.
+    /// @param[in] threads count of threads
+    /// @param[in] worker worker each thread executes with its index
+    /// @param[in] arg argument of the worker
+    /// @param[in] user user parameter pointer
+    /// @retval true when every worker executed and returned
+    /// @retval false when the threads could not be started (no worker executed)
+    typedef bool (*TestStressRunCb_t)(uint32_t threads, TestStressWorker_t worker, void *arg, void *user);
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Concurrency Stress result - operations are iterations of the body.
+    typedef struct TestStressResult_s
+    {
+        uint32_t threads;      ///< Threads executed, 0 when not stressed
+        uint64_t opsPerSec;    ///< Operations per second of all threads together
+        uint64_t minOpsPerSec; ///< Operations per second of the slowest thread
+    } TestStressResult_t;
+
+    /// Concurrency Stress definition
+    typedef struct TestStress_s
+    {
+        TestStressFunc_t    func;            ///< Body executed on every thread
+        void               *user;            ///< User pointer for the body
+        uint32_t            threads;         ///< Count of threads, at most RSTEST_STRESS_MAX_THREADS
+        uint32_t            iterations;      ///< Iterations of the body on each thread
+        uint64_t            clockHz;         ///< Clock ticks per second of the test suite clock (clockCb)
+        uint64_t           *threadOpsPerSec; ///< Operations per second of each thread (threads entries, may be NULL)
+        TestStressResult_t *result;          ///< Throughput of the latest execution (may be NULL)
+    } TestStress_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    // ------------------------------------------------------------------
+    // Stress API
+
+    /// Set the runner of the stress test cases.
+    /// @param[in] runCb runner executing a worker on each thread, NULL for none (stress test cases fail)
+    /// @param[in] user user pointer for the runner
+    void rstest_setStressRunner(TestStressRunCb_t runCb, void *user);
+
+    /// Concurrency Stress test case function (TestCaseParamFunc_t) - see TESTCASE_STRESS_DEF().
+    /// Without a clock in the test suite the operations per second are 0.
+    /// @param[in] param stress definition (TestStress_t)
+    /// @param[in] index unused
+    void rstest_stressCase(const void *param, size_t index);
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// Stress Runner Callback of a host - a pthread per thread (host only).
+    /// @param[in] threads count of threads
+    /// @param[in] worker worker each thread executes with its index
+    /// @param[in] arg argument of the worker
+    /// @param[in] user unused
+    /// @retval true when every worker executed and returned
+    /// @retval false when the threads could not be created
+    bool rstest_stressRunHost(uint32_t threads, TestStressWorker_t worker, void *arg, void *user);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(__cplusplus)
+}
+#endif
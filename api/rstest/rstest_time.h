@@ -0,0 +1,126 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork virtual time.
+/// A clock and timers for the code under test, so timeouts and retry back-off
+/// are tested without real sleeps. The code under test reads the time with
+/// rstest_now() and waits with rstest_sleep() (e.g. its platform layer maps to
+/// them in the test build): a sleep does not wait, it jumps to each pending
+/// timer deadline in turn - executing the timer - and then to the end of the
+/// sleep. The ticks are in the unit of the code under test (e.g. ms).
+///
+/// rstest_run() resets the virtual time to 0 and stops every timer before
+/// each test case, async test cases executing together share it.
+/// Not thread safe - for the test case thread only.
+/// @code
+///    static void retry(TestTimer_t *timer, void *user) { (void)timer; (void)radio_send((Msg_t *)user); }
+///
+///    static void TC_RetryBackoff(void)
+///    {
+///        static TestTimer_t k_retry;
+///        START_TESTCASE();
+///        rstest_timerStart(&k_retry, 100U, 0U, &retry, &k_msg); // 100 ms
+///        rstest_sleep(1000U);                                   // returns at once
+///        ASSERT_TRUE(rstest_now() == 1000U);
+///        END_TESTCASE_PASS();
+///    }
+/// @endcode
+//
+#pragma once
+
+#include <stdint.h>
+#include "rstest/rstest_std_macros.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    struct TestTimer_s;
+
+    /// Timer Callback function - the deadline of the timer was reached.
+    /// The virtual time is the deadline; the callback may start and stop timers and sleep.
+    /// @param[in,out] timer timer that expired
+    /// @param[in] user user parameter pointer
+    typedef void (*TestTimerCb_t)(struct TestTimer_s *timer, void *user);
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Virtual timer - owned by the caller, linked into the pending timers while started.
+    /// Zero initialize before the first start.
+    typedef struct TestTimer_s
+    {
+        uint64_t            deadline; ///< Virtual time the timer expires at
+        uint64_t            period;   ///< Period of a periodic timer, 0 for a one shot timer
+        TestTimerCb_t       cb;       ///< Callback executed at the deadline
+        void               *user;     ///< User pointer for the callback
+        struct TestTimer_s *next;     ///< Next pending timer (internal)
+        bool                pending;  ///< Linked into the pending timers (internal)
+    } TestTimer_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    // ------------------------------------------------------------------
+    // Virtual Time API
+
+    /// Current virtual time.
+    /// @returns the ticks since the start of the test case
+    uint64_t rstest_now(void);
+
+    /// Sleep - advance the virtual time, executing the timers that expire on the way in deadline order.
+    /// Returns without waiting.
+    /// @param[in] ticks ticks to sleep
+    void rstest_sleep(uint64_t ticks);
+
+    /// Advance the virtual time to the next timer deadline and execute the timers expiring at it.
+    /// For code waiting for an event rather than a time (e.g. a blocked queue receive).
+    /// @retval true when a timer was executed
+    /// @retval false when no timer is pending (the time does not change)
+    bool rstest_sleepUntilNext(void);
+
+    /// Start a timer, restarting it when pending.
+    /// @param[in,out] timer timer, pending until it expires or is stopped
+    /// @param[in] delay ticks from now to the deadline
+    /// @param[in] period ticks between the deadlines of a periodic timer, 0 for a one shot timer
+    /// @param[in] cb callback executed at the deadline
+    /// @param[in] user user pointer for the callback
+    void rstest_timerStart(TestTimer_t *timer, uint64_t delay, uint64_t period, TestTimerCb_t cb, void *user);
+
+    /// Stop a timer.
+    /// @param[in,out] timer timer, no longer pending
+    void rstest_timerStop(TestTimer_t *timer);
+
+    /// Reset the virtual time to 0 and stop every timer.
+    /// rstest_run() resets before each test case. The timers are dropped without access, so the
+    /// timers of the previous test case may have been on its stack.
+    void rstest_timeReset(void);
+
+#if defined(__cplusplus)
+}
+#endif
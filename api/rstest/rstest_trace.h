@@ -0,0 +1,142 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork execution trace.
+/// Records begin/end events of the test suite, the startup callback, the test
+/// case bodies, the teardown callback and the failure callback into a
+/// preallocated ring buffer while rstest_run() executes, for a timeline of
+/// where a run spends its time. rstest_traceExport() writes Chrome trace JSON
+/// that opens in Perfetto (ui.perfetto.dev) or chrome://tracing.
+///
+/// The ring buffer is fixed size and lock-free: a writer reserves a slot with
+/// an atomic increment of head and fills it, the latest capacity events are
+/// kept. Each event carries the worker it executed on - 0 for rstest_run(),
+/// the async slot (1..RSTEST_MAX_ASYNC_CASES) for async test cases.
+/// @code
+///    static TestTraceEvent_t k_events[1024];
+///    static TestTrace_t      k_trace = {k_events, 1024U, 0U, &rstest_hostClockNs, NULL};
+///    rstest_setTrace(&k_trace);
+///    rstest_run();
+///    rstest_traceExport(&k_trace, "rstest.trace.json", 1000U); // ns clock
+/// @endcode
+//
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "rstest/rstest.h"
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Test case index of events outside of a test case (suite events).
+#define RSTEST_TRACE_NO_CASE (UINT32_MAX)
+
+    // ------------------------------------------------------------------
+    // Type Definitions
+
+    /// Trace event kind
+    typedef enum TestTraceKind_e
+    {
+        TestTraceKind_Suite    = 0, ///< rstest_run()
+        TestTraceKind_Startup  = 1, ///< Startup callback (or snapshot restore)
+        TestTraceKind_Body     = 2, ///< Test case body (a resume of an async test case)
+        TestTraceKind_Teardown = 3, ///< Teardown callback
+        TestTraceKind_Failure  = 4  ///< Failure callback
+    } TestTraceKind_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+    /// Trace event
+    typedef struct TestTraceEvent_s
+    {
+        uint64_t    time;      ///< Clock of the trace at the event
+        const char *name;      ///< Test suite or test case name
+        uint32_t    caseIndex; ///< Index of the test case, RSTEST_TRACE_NO_CASE for the suite
+        uint16_t    worker;    ///< Worker the event executed on
+        uint8_t     kind;      ///< TestTraceKind_t
+        uint8_t     begin;     ///< 1 for a begin event, 0 for an end event
+    } TestTraceEvent_t;
+
+    /// Trace ring buffer
+    typedef struct TestTrace_s
+    {
+        TestTraceEvent_t *events;      ///< Preallocated events
+        uint32_t          capacity;    ///< Count of events, a power of 2
+        volatile uint32_t head;        ///< Count of events written, the latest capacity are kept
+        TestClockCb_t     clockCb;     ///< Clock of the events (e.g. rstest_hostClockNs)
+        void             *clockCbUser; ///< User pointer for clock callback
+    } TestTrace_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    // ------------------------------------------------------------------
+    // Trace API
+
+    /// Set the trace recorded by rstest_run().
+    /// Clears the events of the trace (head).
+    /// @param[in,out] trace trace, NULL to stop recording.
+    /// @retval true when set
+    /// @retval false when the capacity is not a power of 2 (nothing is recorded)
+    bool rstest_setTrace(TestTrace_t *trace);
+
+    /// Record an event into the trace - e.g. from a worker of the test case.
+    /// @param[in] kind kind of event
+    /// @param[in] begin true for a begin event, false for the end event
+    /// @param[in] caseIndex index of the test case, RSTEST_TRACE_NO_CASE for none
+    /// @param[in] name name of the event
+    /// @param[in] worker worker the event executed on
+    void rstest_traceEvent(TestTraceKind_t kind, bool begin, uint32_t caseIndex, const char *name, uint16_t worker);
+
+    /// Count of events kept in a trace.
+    /// @param[in] trace trace
+    /// @returns the count, at most capacity
+    uint32_t rstest_traceCount(const TestTrace_t *trace);
+
+    /// Get a kept event of a trace, oldest first.
+    /// @param[in] trace trace
+    /// @param[in] index index of the event, less than rstest_traceCount()
+    /// @returns the event
+    const TestTraceEvent_t *rstest_traceGet(const TestTrace_t *trace, uint32_t index);
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// Export a trace as Chrome trace JSON (host only).
+    /// @param[in] trace trace
+    /// @param[in] path file to write
+    /// @param[in] ticksPerUs clock ticks per microsecond (1000 for a ns clock)
+    /// @retval true when written
+    /// @retval false when unable to write
+    bool rstest_traceExport(const TestTrace_t *trace, const char *path, uint64_t ticksPerUs);
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,84 @@
+#######################################################################
+# @copyright 2026 Retlek Systems Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+#
+# Amalgamate rstest into a single header, replacing rstest/rstest.h:
+#   cmake -DRSTEST_SOURCE_DIR=<rstest> -DRSTEST_SINGLE_HEADER=<out>/rstest/rstest.h -P RsTestAmalgamate.cmake
+# The implementation is only compiled where RSTEST_IMPLEMENTATION is defined
+# before including it (exactly one translation unit), so the test suite
+# compiled in that translation unit can inline the framework without LTO.
+
+set(RSTEST_SINGLE_API
+  api/rstest/rstest_std_macros.h
+  api/rstest/rstest_heap.h
+  api/rstest/rstest_perf.h
+  api/rstest/rstest_stack.h
+  api/rstest/rstest_bench.h
+  api/rstest/rstest_stress.h
+  api/rstest/rstest.h
+  api/rstest/rstest_status.h
+  api/rstest/rstest_baseline.h
+  api/rstest/rstest_budget.h
+  api/rstest/rstest_trace.h
+  api/rstest/rstest_checkpoint.h
+  api/rstest/rstest_coverage.h
+  api/rstest/rstest_golden.h
+  api/rstest/rstest_log.h
+  api/rstest/rstest_data.h
+  api/rstest/rstest_time.h
+  api/rstest/rstest_plugin.h
+)
+set(RSTEST_SINGLE_IMPL
+  src/rstest_internal.h
+  src/rstest.c
+  src/rstest_heap.c
+  src/rstest_stack.c
+  src/rstest_status.c
+  src/rstest_trace.c
+  src/rstest_checkpoint.c
+  src/rstest_log.c
+  src/rstest_budget.c
+  src/rstest_bench.c
+  src/rstest_stress.c
+  src/rstest_data.c
+  src/rstest_time.c
+  src/rstest_plugin.c
+)
+
+# Append a source file without its local includes (already amalgamated).
+function(rstest_amalgamate_append _var _file)
+  file(READ ${RSTEST_SOURCE_DIR}/${_file} _content)
+  string(REGEX REPLACE "\n#include \"[^\"]*\"" "" _content "${_content}")
+  string(REGEX REPLACE "\n#pragma once" "" _content "${_content}")
+  set(${_var} "${${_var}}\n// ---- ${_file}\n${_content}" PARENT_SCOPE)
+endfunction()
+
+set(_single "// Generated by RsTestAmalgamate.cmake - do not edit.\n#pragma once\n")
+foreach(_file IN LISTS RSTEST_SINGLE_API)
+  rstest_amalgamate_append(_single ${_file})
+endforeach()
+
+string(APPEND _single "\n#if defined(RSTEST_IMPLEMENTATION)\n")
+foreach(_file IN LISTS RSTEST_SINGLE_IMPL)
+  rstest_amalgamate_append(_single ${_file})
+endforeach()
+string(APPEND _single "\n#endif // defined(RSTEST_IMPLEMENTATION)\n")
+
+file(WRITE ${RSTEST_SINGLE_HEADER} "${_single}")
@@ -0,0 +1,45 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork Example - test data generation test cases.
+
+#include <rstest/rstest_data.h>
+
+#include "example_test_suite.h"
+
+static uint8_t              k_dataPool[2048];
+static TestDataCacheEntry_t k_dataEntries[4];
+TestDataCache_t             RSTC_dataCache = {k_dataEntries, 4U, 0U, k_dataPool, sizeof(k_dataPool), 0U};
+
+void RSTC_data_range(void)
+{
+    static const TestDataSpec_t k_spec = {TestDataType_I32, 0x5EEDU, 256U, -100.0, 100.0};
+    const int32_t              *values = (const int32_t *)rstest_dataGet(&RSTC_dataCache, &k_spec);
+    START_TESTCASE();
+
+    ASSERT_TRUE(values != NULL);
+    for (size_t idx = 0U; (values != NULL) && (idx < k_spec.count); idx++)
+    {
+        ASSERT_TRUE((values[idx] >= -100) && (values[idx] <= 100));
+    }
+
+    END_TESTCASE_PASS();
+}
@@ -0,0 +1,37 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork Fuzzing Example
+/// Fuzzes the parameterized test cases of the example test suite.
+
+#include <rstest/rstest_fuzz.h>
+
+#include "example_test_suite.h"
+
+static TestCase_t RSTestFuzzCases[] = {
+    TESTCASE_PARAM_DEF(RSTC_param_sum_commutes, RSTC_sumVectors, ARRAY_SIZE(RSTC_sumVectors), TestCaseState_Idle),
+    TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle), // Not parameterized - not fuzzed.
+};
+
+static const TestSuite_t RSTestFuzzSuite = {
+    .name = "RSTC Fuzz Suite", .testCases = RSTestFuzzCases, .count = ARRAY_SIZE(RSTestFuzzCases)};
+
+const TestSuite_t *rstest_fuzzTestSuite(void) { return &RSTestFuzzSuite; }
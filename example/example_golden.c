@@ -0,0 +1,57 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork Example - golden file test cases (host only).
+
+#include <rstest/rstest_golden.h>
+
+#include "example_test_suite.h"
+
+const char    *RSTC_goldenPath      = NULL;
+const uint8_t *RSTC_goldenOutput    = NULL;
+size_t         RSTC_goldenOutputLen = 0U;
+
+void RSTC_golden_match(void)
+{
+    START_TESTCASE();
+
+    ASSERT_MATCHES_FILE(RSTC_goldenOutput, RSTC_goldenOutputLen, RSTC_goldenPath);
+
+    END_TESTCASE_PASS();
+}
+
+void RSTC_golden_chunks(void)
+{
+    START_TESTCASE();
+
+    // Output produced a frame at a time.
+    const size_t frameLen = 64U;
+    TestGolden_t golden;
+    ASSERT_MATCHES_FILE_OPEN(&golden, RSTC_goldenPath);
+    for (size_t offset = 0U; offset < RSTC_goldenOutputLen; offset += frameLen)
+    {
+        const size_t remaining = RSTC_goldenOutputLen - offset;
+        ASSERT_MATCHES_FILE_CHUNK(&golden, &RSTC_goldenOutput[offset], (remaining < frameLen) ? remaining : frameLen);
+    }
+    ASSERT_MATCHES_FILE_CLOSE(&golden);
+
+    END_TESTCASE_PASS();
+}
@@ -0,0 +1,56 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork Example - deferred binary logging test cases.
+
+#include <rstest/rstest_log.h>
+
+#include "example_test_suite.h"
+
+void RSTC_log_pass(void)
+{
+    START_TESTCASE();
+
+    RSTEST_LOG("passing %u", 1U);
+
+    END_TESTCASE_PASS();
+}
+
+void RSTC_log_fail(void)
+{
+    START_TESTCASE();
+
+    const int value = -3;
+    RSTEST_LOG("start");
+    RSTEST_LOG("value %d of %s at 0x%04x", value, "step", 0x2aU);
+    ASSERT_TRUE(value > 0);
+    RSTEST_LOG("after %c%%", 'x');
+
+    END_TESTCASE_PASS();
+}
+
+void RSTC_log_no_end(void)
+{
+    START_TESTCASE();
+
+    RSTEST_LOG("before return %u", 7U);
+    ASSERT_TRUE(true);
+}
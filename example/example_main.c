@@ -36,7 +36,7 @@ int main(int argc, char **argv)
                                  TESTCASE_DEF(RSTC_fail_assert_fail_end, TestCaseState_Idle)};
 
     TestSuite_t RSTestSuite1 = {
-        "RSTC Test Suite 1", RSTestCases1, ARRAY_SIZE(RSTestCases1), NULL, NULL, NULL, NULL, NULL, NULL};
+        .name = "RSTC Test Suite 1", .testCases = RSTestCases1, .count = ARRAY_SIZE(RSTestCases1)};
 
     TestCase_t RSTestCases2[] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Disabled),
                                  TESTCASE_DEF(RSTC_fail_end, TestCaseState_Idle),
@@ -46,7 +46,7 @@ int main(int argc, char **argv)
                                  TESTCASE_DEF(RSTC_fail_assert_fail_end, TestCaseState_Idle)};
 
     TestSuite_t RSTestSuite2 = {
-        "RSTC Test Suite 3", RSTestCases2, ARRAY_SIZE(RSTestCases2), NULL, NULL, NULL, NULL, NULL, NULL};
+        .name = "RSTC Test Suite 3", .testCases = RSTestCases2, .count = ARRAY_SIZE(RSTestCases2)};
 
     TestCase_t RSTestCases3[] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
                                  TESTCASE_DEF(RSTC_fail_end, TestCaseState_Disabled),
@@ -56,7 +56,7 @@ int main(int argc, char **argv)
                                  TESTCASE_DEF(RSTC_fail_assert_fail_end, TestCaseState_Disabled)};
 
     TestSuite_t RSTestSuite3 = {
-        "RSTC Test Suite 3", RSTestCases3, ARRAY_SIZE(RSTestCases3), NULL, NULL, NULL, NULL, NULL, NULL};
+        .name = "RSTC Test Suite 3", .testCases = RSTestCases3, .count = ARRAY_SIZE(RSTestCases3)};
 
     TestCase_t RSTestCases4[] = {
         TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
@@ -71,7 +71,7 @@ int main(int argc, char **argv)
         TESTCASE_DEF(RSTC_fail_assert_fail_end, TestCaseState_Disabled)};
 
     TestSuite_t RSTestSuite4 = {
-        "RSTC Test Suite 4", RSTestCases4, ARRAY_SIZE(RSTestCases4), NULL, NULL, NULL, NULL, NULL, NULL};
+        .name = "RSTC Test Suite 4", .testCases = RSTestCases4, .count = ARRAY_SIZE(RSTestCases4)};
 
     const TestReport_t *rpt = NULL;
 
@@ -0,0 +1,45 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork Example - test suite plugin (host only).
+/// Built as a shared object and run by the plugin runner:
+///     rstest_plugin librstest_example_plugin.so
+
+#include <rstest/rstest_plugin.h>
+
+#include "example_test_suite.h"
+
+static TestCase_t k_passCases[] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                   TESTCASE_DEF(RSTC_pass_assert_pass_end, TestCaseState_Idle),
+                                   TESTCASE_DEF(RSTC_fail_end, TestCaseState_Disabled)};
+
+static TestSuite_t k_passSuite = {
+    .name = "RSTC Plugin Suite", .testCases = k_passCases, .count = ARRAY_SIZE(k_passCases)};
+
+static TestCase_t k_timeCases[] = {TESTCASE_DEF(RSTC_retry_backoff, TestCaseState_Idle),
+                                   TESTCASE_DEF(RSTC_retry_backoff, TestCaseState_Idle)};
+
+static TestSuite_t k_timeSuite = {
+    .name = "RSTC Plugin Time Suite", .testCases = k_timeCases, .count = ARRAY_SIZE(k_timeCases)};
+
+static const TestSuite_t *const k_suites[] = {&k_passSuite, &k_timeSuite};
+
+RSTEST_PLUGIN_EXPORT(k_suites);
@@ -74,3 +74,288 @@ void RSTC_fail_assert_fail_end(void)
 
     END_TESTCASE_FAIL();
 }
+
+void RSTC_no_end(void)
+{
+    START_TESTCASE();
+
+    ASSERT_TRUE(true);
+}
+
+// ------------------------------------------------------------------
+// Heap usage test cases
+
+static void *k_heapLeak = NULL; ///< Allocation intentionally leaked by RSTC_heap_leak
+
+void RSTC_heap_balanced(void)
+{
+    START_TESTCASE();
+
+    void *first  = rstest_malloc(16U);
+    void *second = rstest_calloc(4U, 8U);
+    ASSERT_TRUE((first != NULL) && (second != NULL));
+    rstest_free(second);
+    rstest_free(first);
+
+    END_TESTCASE_PASS();
+}
+
+void RSTC_heap_leak(void)
+{
+    START_TESTCASE();
+
+    k_heapLeak = rstest_malloc(64U);
+    ASSERT_TRUE(k_heapLeak != NULL);
+
+    END_TESTCASE_PASS();
+}
+
+void RSTC_heap_realloc(void)
+{
+    START_TESTCASE();
+
+    void *mem = rstest_malloc(8U);
+    mem       = rstest_realloc(mem, 128U);
+    ASSERT_TRUE(mem != NULL);
+    rstest_free(mem);
+
+    END_TESTCASE_PASS();
+}
+
+void RSTC_heap_leakRelease(void)
+{
+    rstest_free(k_heapLeak);
+    k_heapLeak = NULL;
+}
+
+// ------------------------------------------------------------------
+// Parameterized test cases
+
+const RSTC_SumVector_t RSTC_sumVectors[RSTC_SUM_VECTOR_COUNT] = {
+    {1U, 2U, 3U}, {10U, 20U, 30U}, {7U, 8U, 16U}, // Intentionally wrong sum at index 2
+    {0U, 0U, 0U}, {100U, 1U, 101U},
+};
+
+void RSTC_param_sum(const void *param, size_t index)
+{
+    const RSTC_SumVector_t *vector = (const RSTC_SumVector_t *)param;
+    (void)index;
+
+    START_TESTCASE();
+
+    ASSERT_TRUE((vector->a + vector->b) == vector->sum);
+
+    END_TESTCASE_PASS();
+}
+
+void RSTC_param_sum_commutes(const void *param, size_t index)
+{
+    const RSTC_SumVector_t *vector = (const RSTC_SumVector_t *)param;
+    (void)index;
+
+    START_TESTCASE();
+
+    ASSERT_TRUE((vector->a + vector->b) == (vector->b + vector->a));
+
+    END_TESTCASE_PASS();
+}
+
+// ------------------------------------------------------------------
+// Fixture test cases
+
+void RSTC_fixture_count(void)
+{
+    START_TESTCASE();
+
+    uint32_t *counter = (uint32_t *)rstest_fixture();
+    ASSERT_TRUE(counter != NULL);
+    if (counter != NULL)
+    {
+        (*counter)++;
+    }
+
+    END_TESTCASE_PASS();
+}
+
+uint32_t RSTC_regs[4] = {0U};
+
+void RSTC_snapshot_regs(void)
+{
+    START_TESTCASE();
+
+    ASSERT_TRUE(RSTC_regs[0] == 1U);
+    RSTC_regs[0] = 0U;
+    RSTC_regs[3]++;
+
+    END_TESTCASE_PASS();
+}
+
+void (*RSTC_callback)(void) = NULL;
+
+void RSTC_callback_pass(void)
+{
+    START_TESTCASE();
+
+    if (RSTC_callback != NULL)
+    {
+        RSTC_callback();
+    }
+
+    END_TESTCASE_PASS();
+}
+
+uint64_t RSTC_deadlineBudget = 100U;
+
+void RSTC_completes_within(void)
+{
+    START_TESTCASE();
+
+    ASSERT_COMPLETES_WITHIN(RSTC_deadlineBudget, {
+        if (RSTC_callback != NULL)
+        {
+            RSTC_callback();
+        }
+    });
+
+    END_TESTCASE_PASS();
+}
+
+uint32_t RSTC_stackFrames = 4U;
+
+/// Recurse into frames of 256 bytes of stack.
+/// @param[in] frames count of frames
+/// @returns a sum of the frames (keeps each frame live across the recursion)
+static uint32_t stackFrame(uint32_t frames)
+{
+    volatile uint8_t frame[256];
+    for (size_t idx = 0U; idx < sizeof(frame); idx++)
+    {
+        frame[idx] = (uint8_t)frames;
+    }
+    const uint32_t below = (frames > 1U) ? stackFrame(frames - 1U) : 0U;
+    return below + frame[frames % sizeof(frame)];
+}
+
+void RSTC_stack_deep(void)
+{
+    START_TESTCASE();
+
+    ASSERT_TRUE(stackFrame(RSTC_stackFrames) == ((RSTC_stackFrames * (RSTC_stackFrames + 1U)) / 2U));
+
+    END_TESTCASE_PASS();
+}
+
+/// Bit count of the last RSTC_popcount_loop() or RSTC_popcount_clear() - keeps the count live.
+static volatile uint32_t k_popcount = 0U;
+
+/// Word RSTC_bench_popcount counts the bits of.
+static uint32_t k_popcountWord = 0x80402011U;
+
+void RSTC_popcount_loop(void *user)
+{
+    uint32_t word  = *(const volatile uint32_t *)user;
+    uint32_t count = 0U;
+    for (uint32_t bit = 0U; bit < 32U; bit++)
+    {
+        count += (word >> bit) & 1U;
+    }
+    k_popcount = count;
+}
+
+void RSTC_popcount_clear(void *user)
+{
+    uint32_t word  = *(const volatile uint32_t *)user;
+    uint32_t count = 0U;
+    while (word != 0U)
+    {
+        word &= word - 1U;
+        count++;
+    }
+    k_popcount = count;
+}
+
+TestBenchResult_t RSTC_benchPopcountRatio = {0U, 0U, 0U, 0U};
+
+const TestBenchAB_t RSTC_bench_popcount = {&RSTC_popcount_loop, &RSTC_popcount_clear, &k_popcountWord, 16U, 1000U,
+                                           RSTEST_BENCH_NO_CHECK, 0U, &RSTC_benchPopcountRatio};
+
+uint32_t RSTC_stressCounts[4] = {0U, 0U, 0U, 0U};
+
+void RSTC_stress_count(uint32_t thread, uint32_t iteration, void *user)
+{
+    (void)user;
+    ASSERT_TRUE(thread < 4U);
+    if (thread < 4U)
+    {
+        ASSERT_TRUE(RSTC_stressCounts[thread] == iteration);
+        RSTC_stressCounts[thread]++;
+    }
+}
+
+const TestStress_t RSTC_stress_counts = {&RSTC_stress_count, NULL, 4U, 1000U, 0U, NULL, NULL};
+
+void RSTC_stress_alloc(uint32_t thread, uint32_t iteration, void *user)
+{
+    (void)thread;
+    (void)iteration;
+    (void)user;
+    void *block = NULL;
+    ASSERT_COMPLETES_WITHIN(1000000U, block = rstest_malloc(16U));
+    ASSERT_TRUE(block != NULL);
+    rstest_free(block);
+}
+
+const TestStress_t RSTC_stress_allocs = {&RSTC_stress_alloc, NULL, 4U, 1000U, 0U, NULL, NULL};
+
+// ------------------------------------------------------------------
+// Async test cases
+
+uint32_t RSTC_asyncTicks = 0U;
+
+bool RSTC_async_tick(void *user)
+{
+    const uint32_t *limit = (const uint32_t *)user;
+    RSTC_asyncTicks++;
+    return (RSTC_asyncTicks < *limit);
+}
+
+void RSTC_async_wait2(TestAsync_t *async)
+{
+    static uint32_t start = 0U;
+
+    RSTEST_ASYNC_BEGIN(async);
+    START_TESTCASE();
+
+    start = RSTC_asyncTicks;
+    RSTEST_AWAIT(async, (RSTC_asyncTicks - start) >= 2U);
+    ASSERT_TRUE((RSTC_asyncTicks - start) == 2U);
+
+    END_TESTCASE_PASS();
+    RSTEST_ASYNC_END(async);
+}
+
+void RSTC_async_wait3(TestAsync_t *async)
+{
+    static uint32_t start = 0U;
+
+    RSTEST_ASYNC_BEGIN(async);
+    START_TESTCASE();
+
+    start = RSTC_asyncTicks;
+    RSTEST_AWAIT(async, (RSTC_asyncTicks - start) >= 3U);
+    ASSERT_TRUE((RSTC_asyncTicks - start) == 3U);
+
+    END_TESTCASE_PASS();
+    RSTEST_ASYNC_END(async);
+}
+
+void RSTC_async_never(TestAsync_t *async)
+{
+    RSTEST_ASYNC_BEGIN(async);
+    START_TESTCASE();
+
+    RSTEST_AWAIT(async, RSTC_asyncTicks == UINT32_MAX);
+
+    END_TESTCASE_PASS();
+    RSTEST_ASYNC_END(async);
+}
@@ -30,12 +30,141 @@ extern "C"
 {
 #endif
 
+/// Count of entries in RSTC_sumVectors
+#define RSTC_SUM_VECTOR_COUNT (5U)
+
+    /// Parameter of RSTC_param_sum
+    typedef struct RSTC_SumVector_s
+    {
+        uint32_t a;   ///< First operand
+        uint32_t b;   ///< Second operand
+        uint32_t sum; ///< Expected sum
+    } RSTC_SumVector_t;
+
+    /// Sum vectors - entry 2 is intentionally wrong.
+    extern const RSTC_SumVector_t RSTC_sumVectors[RSTC_SUM_VECTOR_COUNT];
+
     void RSTC_pass_end(void);
     void RSTC_fail_end(void);
     void RSTC_pass_assert_pass_end(void);
     void RSTC_pass_assert_fail_end(void);
     void RSTC_fail_assert_pass_end(void);
     void RSTC_fail_assert_fail_end(void);
+    /// Returns without ending - a failure without a failing assertion.
+    void RSTC_no_end(void);
+
+    void RSTC_heap_balanced(void);
+    void RSTC_heap_leak(void);
+    void RSTC_heap_realloc(void);
+    /// Release the allocation leaked by RSTC_heap_leak (not a test case).
+    void RSTC_heap_leakRelease(void);
+
+    void RSTC_param_sum(const void *param, size_t index);
+    void RSTC_param_sum_commutes(const void *param, size_t index);
+
+    /// Increments the uint32_t counter of the fixture context (rstest_fixture()).
+    void RSTC_fixture_count(void);
+
+    /// Simulated device register file of the snapshot test cases.
+    extern uint32_t RSTC_regs[4];
+
+    /// Expects RSTC_regs as setup by the startup callback (RSTC_regs[0] == 1) then modifies them.
+    void RSTC_snapshot_regs(void);
+
+    /// Code under test executed by RSTC_callback_pass (may be NULL).
+    extern void (*RSTC_callback)(void);
+
+    /// Executes RSTC_callback then passes.
+    void RSTC_callback_pass(void);
+
+    /// Budget of the ASSERT_COMPLETES_WITHIN() of RSTC_completes_within in clock ticks.
+    extern uint64_t RSTC_deadlineBudget;
+
+    /// Executes RSTC_callback within RSTC_deadlineBudget then passes.
+    void RSTC_completes_within(void);
+
+    /// Frames of 256 bytes RSTC_stack_deep recurses into.
+    extern uint32_t RSTC_stackFrames;
+
+    /// Uses RSTC_stackFrames frames of stack then passes.
+    void RSTC_stack_deep(void);
+
+    /// Bit count of a word - one bit at a time (old implementation of RSTC_bench_popcount).
+    /// @param[in] user uint32_t word to count
+    void RSTC_popcount_loop(void *user);
+    /// Bit count of a word - clearing the lowest set bit (new implementation of RSTC_bench_popcount).
+    /// @param[in] user uint32_t word to count
+    void RSTC_popcount_clear(void *user);
+
+    /// Paired A/B benchmark of RSTC_popcount_loop and RSTC_popcount_clear (TESTCASE_BENCH_DEF()).
+    extern const TestBenchAB_t RSTC_bench_popcount;
+    /// Ratio of the latest execution of RSTC_bench_popcount.
+    extern TestBenchResult_t RSTC_benchPopcountRatio;
+
+    /// Iterations counted by each thread of RSTC_stress_counts.
+    extern uint32_t RSTC_stressCounts[4];
+
+    /// Counts an iteration of a thread in its own slot of RSTC_stressCounts (the slot equals the iteration).
+    /// @param[in] thread index of the thread, fails when not less than 4
+    /// @param[in] iteration index of the iteration on the thread
+    /// @param[in] user unused
+    void RSTC_stress_count(uint32_t thread, uint32_t iteration, void *user);
+
+    /// Concurrency stress of RSTC_stress_count - 4 threads of 1000 iterations (TESTCASE_STRESS_DEF()).
+    extern const TestStress_t RSTC_stress_counts;
+
+    /// Allocates and frees a block within a deadline (ASSERT_COMPLETES_WITHIN()) on every thread.
+    /// @param[in] thread unused
+    /// @param[in] iteration unused
+    /// @param[in] user unused
+    void RSTC_stress_alloc(uint32_t thread, uint32_t iteration, void *user);
+
+    /// Concurrency stress of RSTC_stress_alloc - 4 threads of 1000 iterations (TESTCASE_STRESS_DEF()).
+    extern const TestStress_t RSTC_stress_allocs;
+
+    /// Dataset cache of RSTC_data_range (rstest/rstest_data.h).
+    extern struct TestDataCache_s RSTC_dataCache;
+
+    /// Gets 256 integers within [-100, 100] from RSTC_dataCache and checks their range (example_data.c).
+    void RSTC_data_range(void);
+
+    /// Failed attempts before the send of RSTC_retry_backoff succeeds.
+    extern uint32_t RSTC_retryFailures;
+
+    /// Sends with exponential back-off (rstest_sleep()) and checks the attempts and the virtual time
+    /// (example_time.c).
+    void RSTC_retry_backoff(void);
+
+    /// Logs a message (RSTEST_LOG()) then passes (example_log.c).
+    void RSTC_log_pass(void);
+    /// Logs messages (RSTEST_LOG()) around a failing assertion.
+    void RSTC_log_fail(void);
+    /// Logs a message (RSTEST_LOG()) then returns without ending.
+    void RSTC_log_no_end(void);
+
+    /// Golden file of the golden test cases (host only, example_golden.c).
+    extern const char *RSTC_goldenPath;
+    /// Output the golden test cases compare with RSTC_goldenPath.
+    extern const uint8_t *RSTC_goldenOutput;
+    /// Length of RSTC_goldenOutput in bytes.
+    extern size_t RSTC_goldenOutputLen;
+
+    /// Compares the whole output with the golden file.
+    void RSTC_golden_match(void);
+    /// Compares the output with the golden file a frame at a time.
+    void RSTC_golden_chunks(void);
+
+    /// Simulated ticks advanced by RSTC_async_tick.
+    extern uint32_t RSTC_asyncTicks;
+
+    /// Async poll callback - advances the simulated ticks (not a test case).
+    /// @param[in] user pointer to the uint32_t tick limit
+    /// @retval false once the tick limit is reached
+    bool RSTC_async_tick(void *user);
+
+    void RSTC_async_wait2(TestAsync_t *async);
+    void RSTC_async_wait3(TestAsync_t *async);
+    void RSTC_async_never(TestAsync_t *async);
 
 #if defined(__cplusplus)
 }
@@ -0,0 +1,60 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork Example - virtual time test cases.
+
+#include <rstest/rstest_time.h>
+
+#include "example_test_suite.h"
+
+uint32_t RSTC_retryFailures = 3U;
+
+/// Code under test - send with exponential back-off between the attempts.
+/// @param[in] attempts maximum attempts
+/// @param[out] sent attempts made
+/// @retval true when an attempt succeeded
+static bool sendWithRetry(uint32_t attempts, uint32_t *sent)
+{
+    uint64_t backoff = 100U;
+    for (*sent = 1U; *sent <= attempts; (*sent)++)
+    {
+        if (*sent > RSTC_retryFailures)
+        {
+            return true;
+        }
+        rstest_sleep(backoff);
+        backoff *= 2U;
+    }
+    return false;
+}
+
+void RSTC_retry_backoff(void)
+{
+    uint32_t sent = 0U;
+    START_TESTCASE();
+
+    ASSERT_TRUE(sendWithRetry(5U, &sent));
+    ASSERT_TRUE(sent == (RSTC_retryFailures + 1U));
+    // 100 + 200 + 400 ticks of back-off without waiting.
+    ASSERT_TRUE(rstest_now() == (100U * ((1U << RSTC_retryFailures) - 1U)));
+
+    END_TESTCASE_PASS();
+}
@@ -36,7 +36,7 @@ namespace
 {
 
 constexpr TestCaseState_t AllTCStates[] = {TestCaseState_Idle, TestCaseState_Disabled, TestCaseState_Executing,
-                                           TestCaseState_Pass, TestCaseState_Fail};
+                                           TestCaseState_Pass, TestCaseState_Fail, TestCaseState_Blocked};
 
 const char DefaultTestSuiteName[] = "TSName"; ///< Default Test suite name
 } // namespace
@@ -51,15 +51,30 @@ public:
     /// @param[in] testCases contiguous memory of test cases
     /// @param[in] count count of the number of testcases
     explicit RSTestLibTest(TestCase_t *testCases, size_t count)
-        : m_testSuite(TestSuite_t{.name           = DefaultTestSuiteName,
-                                  .testCases      = testCases,
-                                  .count          = count,
-                                  .startupCb      = &RSTestLibTest::startupCallback,
-                                  .startupCbUser  = this,
-                                  .teardownCb     = &RSTestLibTest::teardownCallback,
-                                  .teardownCbUser = this,
-                                  .failureCb      = &RSTestLibTest::failureCallback,
-                                  .failureCbUser  = this})
+        : m_testSuite(TestSuite_t{.name                = DefaultTestSuiteName,
+                                  .testCases           = testCases,
+                                  .count               = count,
+                                  .startupCb           = &RSTestLibTest::startupCallback,
+                                  .startupCbUser       = this,
+                                  .teardownCb          = &RSTestLibTest::teardownCallback,
+                                  .teardownCbUser      = this,
+                                  .failureCb           = &RSTestLibTest::failureCallback,
+                                  .failureCbUser       = this,
+                                  .heapLimits          = nullptr,
+                                  .paramBatch          = 0U,
+                                  .asyncPollCb         = nullptr,
+                                  .asyncPollCbUser     = nullptr,
+                                  .clockCb             = nullptr,
+                                  .clockCbUser         = nullptr,
+                                  .baseline            = nullptr,
+                                  .suiteStartupCb      = nullptr,
+                                  .suiteStartupCbUser  = nullptr,
+                                  .suiteTeardownCb     = nullptr,
+                                  .suiteTeardownCbUser = nullptr,
+                                  .snapshotRegions     = nullptr,
+                                  .snapshotCount       = 0U,
+                                  .perfLimits          = nullptr,
+                                  .stack               = nullptr})
     {
     }
 
@@ -300,8 +315,9 @@ TEST_F(RSTestLibMultiTest, allIdle)
     EXPECT_THAT(report->disabledCount, Eq(0));
     EXPECT_THAT(report->passCount, Eq(2));
     EXPECT_THAT(report->failCount, Eq(4));
-    // Two passing tests and two ASSERT_TRUE, but one failing pass_end not accounted for.
-    EXPECT_THAT(report->passAsserts.count, Eq(4));
+    // Two passing tests (one failing pass_end not accounted for) and two counted ASSERT_TRUE.
+    EXPECT_THAT(report->passAsserts.count, Eq(2));
+    EXPECT_THAT(report->passAssertCount, Eq(2));
     EXPECT_THAT(report->failAsserts.count, Eq(5));
 }
 
@@ -387,7 +403,8 @@ TEST_F(RSTestLibMultiTest, onlyPassing)
     EXPECT_THAT(report->disabledCount, Eq(4));
     EXPECT_THAT(report->passCount, Eq(2));
     EXPECT_THAT(report->failCount, Eq(0));
-    EXPECT_THAT(report->passAsserts.count, Eq(3)); // Two passing tests and one ASSERT_TRUE.
+    EXPECT_THAT(report->passAsserts.count, Eq(2)); // Two passing tests.
+    EXPECT_THAT(report->passAssertCount, Eq(1));
     EXPECT_THAT(report->failAsserts.count, Eq(0));
 }
 
@@ -443,7 +460,8 @@ TEST_F(RSTestLibMultiTest, onlyPassingDoubleRun)
     EXPECT_THAT(report->disabledCount, Eq(4));
     EXPECT_THAT(report->passCount, Eq(2));
     EXPECT_THAT(report->failCount, Eq(0));
-    EXPECT_THAT(report->passAsserts.count, Eq(3)); // Two passing tests and one ASSERT_TRUE.
+    EXPECT_THAT(report->passAsserts.count, Eq(2)); // Two passing tests.
+    EXPECT_THAT(report->passAssertCount, Eq(1));
     EXPECT_THAT(report->failAsserts.count, Eq(0));
 
     // Second run will double report values.
@@ -456,6 +474,495 @@ TEST_F(RSTestLibMultiTest, onlyPassingDoubleRun)
     EXPECT_THAT(report->disabledCount, Eq(8));
     EXPECT_THAT(report->passCount, Eq(4));
     EXPECT_THAT(report->failCount, Eq(0));
-    EXPECT_THAT(report->passAsserts.count, Eq(6)); // Two passing tests and one ASSERT_TRUE.
+    EXPECT_THAT(report->passAsserts.count, Eq(4)); // Two passing tests per run.
+    EXPECT_THAT(report->passAssertCount, Eq(2));
     EXPECT_THAT(report->failAsserts.count, Eq(0));
 }
+
+//-----------------------------------------------------------------------------
+
+using RSTestLibParamTest = RSTestLibTest;
+
+TEST_F(RSTestLibParamTest, perParameterResults)
+{
+    TestCase_t RSTC_Param[] = {
+        TESTCASE_PARAM_DEF(RSTC_param_sum, RSTC_sumVectors, ARRAY_SIZE(RSTC_sumVectors), TestCaseState_Idle)};
+
+    m_testSuite.testCases = &(RSTC_Param[0]);
+    m_testSuite.count     = ARRAY_SIZE(RSTC_Param);
+
+    // Expectations - startup and teardown around every parameter.
+    EXPECT_CALL(m_startupCb, Call()).Times(RSTC_SUM_VECTOR_COUNT);
+    EXPECT_CALL(m_teardownCb, Call()).Times(RSTC_SUM_VECTOR_COUNT);
+    EXPECT_CALL(m_failureCb, Call(Field(&AssertRecord_t::param, Eq(2U)))).Times(1);
+
+    // Execution
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+    const auto *report = rstest_getReport();
+    checkReportValidity(report);
+
+    EXPECT_THAT(report->executedCount, Eq(1));
+    EXPECT_THAT(report->failCount, Eq(1));
+    ASSERT_THAT(report->caseResults.count, Eq(1));
+    const auto &result = report->caseResults.records[0];
+    EXPECT_THAT(result.state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(result.paramCount, Eq(RSTC_SUM_VECTOR_COUNT));
+    EXPECT_THAT(result.paramFailCount, Eq(1));
+    EXPECT_THAT(result.paramFirstFail, Eq(2));
+    EXPECT_THAT(report->passAsserts.count, Eq(RSTC_SUM_VECTOR_COUNT - 1U)); // END_TESTCASE_PASS per passing parameter.
+    EXPECT_THAT(report->passAssertCount, Eq(RSTC_SUM_VECTOR_COUNT - 1U));
+    ASSERT_THAT(report->failAsserts.count, Eq(1));
+    EXPECT_THAT(report->failAsserts.records[0].param, Eq(2));
+}
+
+TEST_F(RSTestLibParamTest, batchedParameters)
+{
+    TestCase_t RSTC_Param[] = {TESTCASE_PARAM_DEF(RSTC_param_sum, RSTC_sumVectors, 2U, TestCaseState_Idle),
+                               TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle)};
+
+    m_testSuite.testCases  = &(RSTC_Param[0]);
+    m_testSuite.count      = ARRAY_SIZE(RSTC_Param);
+    m_testSuite.paramBatch = 8U;
+
+    // Expectations - both parameters share one startup and teardown.
+    EXPECT_CALL(m_startupCb, Call()).Times(2);
+    EXPECT_CALL(m_teardownCb, Call()).Times(2);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+
+    // Execution
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    const auto *report = rstest_getReport();
+    checkReportValidity(report);
+
+    EXPECT_THAT(report->passCount, Eq(2));
+    EXPECT_THAT(report->caseResults.records[0].paramCount, Eq(2));
+    EXPECT_THAT(report->caseResults.records[0].paramFailCount, Eq(0));
+    EXPECT_THAT(report->caseResults.records[0].paramFirstFail, Eq(RSTEST_NO_PARAM));
+    EXPECT_THAT(report->caseResults.records[1].paramCount, Eq(0));
+}
+
+TEST_F(RSTestLibParamTest, missingFunctionRejected)
+{
+    TestCase_t RSTC_Param[] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle)};
+    RSTC_Param[0].func      = nullptr;
+
+    m_testSuite.testCases = &(RSTC_Param[0]);
+    m_testSuite.count     = ARRAY_SIZE(RSTC_Param);
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsFalse());
+    EXPECT_THAT(rstest_run(), IsFalse());
+}
+
+//-----------------------------------------------------------------------------
+
+using RSTestLibAssertTest = RSTestLibTest;
+
+TEST_F(RSTestLibAssertTest, failureRecordLocation)
+{
+    TestCase_t RSTC_Assert[] = {TESTCASE_DEF(RSTC_fail_assert_pass_end, TestCaseState_Idle),
+                                TESTCASE_DEF(RSTC_pass_assert_pass_end, TestCaseState_Idle)};
+
+    m_testSuite.testCases = &(RSTC_Assert[0]);
+    m_testSuite.count     = ARRAY_SIZE(RSTC_Assert);
+
+    // Expectations - failure recorded out of line with the file name (no path).
+    EXPECT_CALL(m_startupCb, Call()).Times(2);
+    EXPECT_CALL(m_teardownCb, Call()).Times(2);
+    EXPECT_CALL(m_failureCb, Call(AllOf(Field(&AssertRecord_t::file, StrEq("example_test_suite.c")),
+                                        Field(&AssertRecord_t::line, Ne(0U)),
+                                        Field(&AssertRecord_t::param, Eq(RSTEST_NO_PARAM)))))
+        .Times(1);
+
+    // Execution
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    const auto *report = rstest_getReport();
+    checkReportValidity(report);
+
+    EXPECT_THAT(report->failCount, Eq(1));
+    EXPECT_THAT(report->passCount, Eq(1));
+    EXPECT_THAT(report->failAsserts.count, Eq(1));
+    EXPECT_THAT(report->passAsserts.count, Eq(1));
+    EXPECT_THAT(report->passAssertCount, Eq(1));
+}
+
+//-----------------------------------------------------------------------------
+
+class RSTestLibFixtureTest : public RSTestLibTest
+{
+public:
+    RSTestLibFixtureTest()
+    {
+        m_testSuite.suiteStartupCb      = &RSTestLibFixtureTest::suiteStartupCallback;
+        m_testSuite.suiteStartupCbUser  = this;
+        m_testSuite.suiteTeardownCb     = &RSTestLibFixtureTest::suiteTeardownCallback;
+        m_testSuite.suiteTeardownCbUser = this;
+    }
+
+protected:
+    /// Suite Startup Callback - the counter is the fixture context.
+    static void *suiteStartupCallback(void *user)
+    {
+        auto that = reinterpret_cast<RSTestLibFixtureTest *>(user);
+        that->m_suiteStartupCb.Call();
+        return &(that->m_counter);
+    }
+
+    /// Suite Teardown Callback
+    static void suiteTeardownCallback(void *user, void *fixture)
+    {
+        auto that = reinterpret_cast<RSTestLibFixtureTest *>(user);
+        that->m_suiteTeardownCb.Call(fixture);
+    }
+
+    MockFunction<void()>              m_suiteStartupCb;  ///< Suite Startup Callback Function check
+    MockFunction<void(void *fixture)> m_suiteTeardownCb; ///< Suite Teardown Callback Function check
+    uint32_t                          m_counter = 0U;    ///< Fixture context
+};
+
+TEST_F(RSTestLibFixtureTest, oncePerRun)
+{
+    TestCase_t RSTC_Fixture[] = {TESTCASE_DEF(RSTC_fixture_count, TestCaseState_Idle),
+                                 TESTCASE_DEF(RSTC_fixture_count, TestCaseState_Disabled),
+                                 TESTCASE_DEF(RSTC_fixture_count, TestCaseState_Idle),
+                                 TESTCASE_DEF(RSTC_fixture_count, TestCaseState_Idle)};
+
+    m_testSuite.testCases = &(RSTC_Fixture[0]);
+    m_testSuite.count     = ARRAY_SIZE(RSTC_Fixture);
+
+    // Expectations - suite startup/teardown once per run, startup/teardown per test case.
+    {
+        InSequence sequence;
+        EXPECT_CALL(m_suiteStartupCb, Call()).Times(1);
+        EXPECT_CALL(m_startupCb, Call()).Times(3);
+        EXPECT_CALL(m_suiteTeardownCb, Call(Eq(&m_counter))).Times(1);
+        EXPECT_CALL(m_suiteStartupCb, Call()).Times(1);
+        EXPECT_CALL(m_startupCb, Call()).Times(3);
+        EXPECT_CALL(m_suiteTeardownCb, Call(Eq(&m_counter))).Times(1);
+    }
+    EXPECT_CALL(m_teardownCb, Call()).Times(6);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+
+    // Execution
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(m_counter, Eq(6U));
+    EXPECT_THAT(rstest_fixture(), IsNull()); // Only while running.
+}
+
+TEST_F(RSTestLibFixtureTest, noFixture)
+{
+    TestCase_t RSTC_Fixture[] = {TESTCASE_DEF(RSTC_fixture_count, TestCaseState_Idle)};
+
+    m_testSuite.testCases      = &(RSTC_Fixture[0]);
+    m_testSuite.count          = ARRAY_SIZE(RSTC_Fixture);
+    m_testSuite.suiteStartupCb = nullptr;
+
+    EXPECT_CALL(m_startupCb, Call()).Times(1);
+    EXPECT_CALL(m_teardownCb, Call()).Times(1);
+    EXPECT_CALL(m_suiteTeardownCb, Call(IsNull())).Times(1);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(1);
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+}
+
+//-----------------------------------------------------------------------------
+
+class RSTestLibSnapshotTest : public RSTestLibTest
+{
+public:
+    RSTestLibSnapshotTest()
+    {
+        m_testSuite.testCases       = &(m_cases[0]);
+        m_testSuite.count           = ARRAY_SIZE(m_cases);
+        m_testSuite.snapshotRegions = &m_region;
+        m_testSuite.snapshotCount   = 1U;
+
+        std::fill(std::begin(RSTC_regs), std::end(RSTC_regs), 0U);
+        ON_CALL(m_startupCb, Call()).WillByDefault([]() {
+            RSTC_regs[0] = 1U;
+            RSTC_regs[3] = 10U;
+        });
+    }
+
+protected:
+    TestCase_t           m_cases[3] = {TESTCASE_DEF(RSTC_snapshot_regs, TestCaseState_Idle),
+                                       TESTCASE_DEF(RSTC_snapshot_regs, TestCaseState_Idle),
+                                       TESTCASE_DEF(RSTC_snapshot_regs, TestCaseState_Idle)};
+    uint32_t             m_copy[ARRAY_SIZE(RSTC_regs)] = {}; ///< Snapshot storage
+    TestSnapshotRegion_t m_region = {.addr = &(RSTC_regs[0]), .copy = &(m_copy[0]), .size = sizeof(RSTC_regs)};
+};
+
+TEST_F(RSTestLibSnapshotTest, startupOnceRestorePerCase)
+{
+    EXPECT_CALL(m_startupCb, Call()).Times(1);
+    EXPECT_CALL(m_teardownCb, Call()).Times(1);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(m_copy[0], Eq(1U));
+    EXPECT_THAT(RSTC_regs[3], Eq(11U)); // Only the last test case increment remains.
+}
+
+TEST_F(RSTestLibSnapshotTest, startupOncePerRun)
+{
+    EXPECT_CALL(m_startupCb, Call()).Times(2);
+    EXPECT_CALL(m_teardownCb, Call()).Times(2);
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+}
+
+TEST_F(RSTestLibSnapshotTest, noSnapshotRegions)
+{
+    m_testSuite.snapshotCount = 0U;
+
+    // Startup and teardown per test case, the regions are not captured.
+    EXPECT_CALL(m_startupCb, Call()).Times(3);
+    EXPECT_CALL(m_teardownCb, Call()).Times(3);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(m_copy[0], Eq(0U));
+}
+
+//-----------------------------------------------------------------------------
+
+class RSTestLibDependsTest : public RSTestLibTest
+{
+protected:
+    static constexpr const char *k_needsPass[]       = {"RSTC_pass_end", nullptr};
+    static constexpr const char *k_needsFail[]       = {"RSTC_fail_end", nullptr};
+    static constexpr const char *k_needsBlocked[]    = {"RSTC_pass_assert_fail_end", nullptr};
+    static constexpr const char *k_needsAssertPass[] = {"RSTC_pass_assert_pass_end", nullptr};
+    static constexpr const char *k_needsUnknown[]    = {"RSTC_unknown", nullptr};
+    static constexpr const char *k_needsAsync[]      = {"RSTC_async_wait2", nullptr};
+
+    /// Initialize and run the test cases.
+    /// @param[in] testCases test cases of the suite
+    template <size_t N>
+    void run(TestCase_t (&testCases)[N])
+    {
+        m_testSuite.testCases = &(testCases[0]);
+        m_testSuite.count     = N;
+        ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+        EXPECT_THAT(rstest_run(), IsTrue());
+    }
+};
+
+TEST_F(RSTestLibDependsTest, prerequisiteExecutesFirst)
+{
+    TestCase_t testCases[] = {TESTCASE_DEPENDS_DEF(RSTC_pass_assert_pass_end, k_needsPass, TestCaseState_Idle),
+                              TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle)};
+
+    EXPECT_CALL(m_startupCb, Call()).Times(2);
+    EXPECT_CALL(m_teardownCb, Call()).Times(2);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+    run(testCases);
+
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    ASSERT_THAT(report->passAsserts.count, Eq(2U));
+    EXPECT_THAT(report->passAsserts.records[0].line, Lt(report->passAsserts.records[1].line)); // RSTC_pass_end first
+    EXPECT_THAT(report->caseResults.records[0].level, Eq(1U));
+    EXPECT_THAT(report->caseResults.records[1].level, Eq(0U));
+}
+
+TEST_F(RSTestLibDependsTest, failedPrerequisiteBlocks)
+{
+    TestCase_t testCases[] = {TESTCASE_DEF(RSTC_fail_end, TestCaseState_Idle),
+                              TESTCASE_DEPENDS_DEF(RSTC_pass_assert_fail_end, k_needsFail, TestCaseState_Idle),
+                              TESTCASE_DEPENDS_DEF(RSTC_pass_assert_pass_end, k_needsBlocked, TestCaseState_Idle),
+                              TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle)};
+
+    // Only the failing prerequisite and the independent test case execute.
+    EXPECT_CALL(m_startupCb, Call()).Times(2);
+    EXPECT_CALL(m_teardownCb, Call()).Times(2);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(1);
+    run(testCases);
+
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->executedCount, Eq(2U));
+    EXPECT_THAT(report->passCount, Eq(1U));
+    EXPECT_THAT(report->failCount, Eq(1U));
+    EXPECT_THAT(report->blockedCount, Eq(2U));
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Blocked));
+    EXPECT_THAT(report->caseResults.records[2].state, Eq(TestCaseState_Blocked));
+    EXPECT_THAT(report->caseResults.records[2].level, Eq(2U));
+    EXPECT_THAT(report->caseResults.records[3].state, Eq(TestCaseState_Pass));
+}
+
+TEST_F(RSTestLibDependsTest, disabledPrerequisiteBlocks)
+{
+    TestCase_t testCases[] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Disabled),
+                              TESTCASE_DEPENDS_DEF(RSTC_pass_assert_pass_end, k_needsPass, TestCaseState_Idle)};
+
+    EXPECT_CALL(m_startupCb, Call()).Times(0);
+    run(testCases);
+
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->disabledCount, Eq(1U));
+    EXPECT_THAT(report->blockedCount, Eq(1U));
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+}
+
+TEST_F(RSTestLibDependsTest, cycleBlocks)
+{
+    TestCase_t testCases[] = {TESTCASE_DEPENDS_DEF(RSTC_pass_end, k_needsAssertPass, TestCaseState_Idle),
+                              TESTCASE_DEPENDS_DEF(RSTC_pass_assert_pass_end, k_needsPass, TestCaseState_Idle)};
+
+    EXPECT_CALL(m_startupCb, Call()).Times(0);
+    run(testCases);
+
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->executedCount, Eq(0U));
+    EXPECT_THAT(report->blockedCount, Eq(2U));
+}
+
+TEST_F(RSTestLibDependsTest, asyncBlocked)
+{
+    TestCase_t testCases[] = {TESTCASE_DEF(RSTC_fail_end, TestCaseState_Idle),
+                              TESTCASE_ASYNC_DEF(RSTC_async_wait2, TestCaseState_Idle)};
+    testCases[1].depends   = k_needsFail;
+
+    EXPECT_CALL(m_startupCb, Call()).Times(1);
+    run(testCases);
+
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Blocked));
+    EXPECT_THAT(report->blockedCount, Eq(1U));
+}
+
+TEST_F(RSTestLibDependsTest, invalidPrerequisites)
+{
+    TestCase_t unknown[] = {TESTCASE_DEPENDS_DEF(RSTC_pass_end, k_needsUnknown, TestCaseState_Idle)};
+    TestCase_t self[]    = {TESTCASE_DEPENDS_DEF(RSTC_pass_end, k_needsPass, TestCaseState_Idle)};
+    TestCase_t async[]   = {TESTCASE_ASYNC_DEF(RSTC_async_wait2, TestCaseState_Idle),
+                            TESTCASE_DEPENDS_DEF(RSTC_pass_end, k_needsAsync, TestCaseState_Idle)};
+
+    for (auto [testCases, count] : {pair{&(unknown[0]), ARRAY_SIZE(unknown)}, pair{&(self[0]), ARRAY_SIZE(self)},
+                                    pair{&(async[0]), ARRAY_SIZE(async)}})
+    {
+        m_testSuite.testCases = testCases;
+        m_testSuite.count     = count;
+        EXPECT_THAT(rstest_init(&m_testSuite), IsFalse());
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+class RSTestLibAsyncTest : public RSTestLibTest
+{
+public:
+    RSTestLibAsyncTest() { RSTC_asyncTicks = 0U; }
+
+protected:
+    uint32_t m_tickLimit = 10U; ///< Ticks before the poll callback gives up
+};
+
+TEST_F(RSTestLibAsyncTest, overlappingWaits)
+{
+    TestCase_t RSTC_Async[] = {TESTCASE_ASYNC_DEF(RSTC_async_wait2, TestCaseState_Idle),
+                               TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                               TESTCASE_ASYNC_DEF(RSTC_async_wait3, TestCaseState_Idle)};
+
+    m_testSuite.testCases       = &(RSTC_Async[0]);
+    m_testSuite.count           = ARRAY_SIZE(RSTC_Async);
+    m_testSuite.asyncPollCb     = &RSTC_async_tick;
+    m_testSuite.asyncPollCbUser = &m_tickLimit;
+
+    // Expectations
+    EXPECT_CALL(m_startupCb, Call()).Times(3);
+    EXPECT_CALL(m_teardownCb, Call()).Times(3);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+
+    // Execution
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    const auto *report = rstest_getReport();
+    checkReportValidity(report);
+
+    // Waits overlap - the longest wait and not the sum of them.
+    EXPECT_THAT(RSTC_asyncTicks, Eq(3U));
+    EXPECT_THAT(report->passCount, Eq(3));
+    EXPECT_THAT(report->caseResults.records[0].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(report->caseResults.records[2].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(report->passAsserts.count, Eq(3)); // Three passing tests.
+    EXPECT_THAT(report->passAssertCount, Eq(2));
+}
+
+TEST_F(RSTestLibAsyncTest, pollGivesUp)
+{
+    TestCase_t RSTC_Async[] = {TESTCASE_ASYNC_DEF(RSTC_async_never, TestCaseState_Idle),
+                               TESTCASE_ASYNC_DEF(RSTC_async_wait2, TestCaseState_Idle)};
+
+    m_testSuite.testCases       = &(RSTC_Async[0]);
+    m_testSuite.count           = ARRAY_SIZE(RSTC_Async);
+    m_testSuite.asyncPollCb     = &RSTC_async_tick;
+    m_testSuite.asyncPollCbUser = &m_tickLimit;
+
+    // Expectations - only the never completing test case fails, where it waits.
+    EXPECT_CALL(m_startupCb, Call()).Times(2);
+    EXPECT_CALL(m_teardownCb, Call()).Times(2);
+    EXPECT_CALL(m_failureCb, Call(AllOf(Field(&AssertRecord_t::file, NotNull()),
+                                        Field(&AssertRecord_t::line, Ne(0U)))))
+        .Times(1);
+
+    // Execution
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+    const auto *report = rstest_getReport();
+    checkReportValidity(report);
+
+    EXPECT_THAT(RSTC_asyncTicks, Eq(m_tickLimit));
+    EXPECT_THAT(report->passCount, Eq(1));
+    EXPECT_THAT(report->failCount, Eq(1));
+    EXPECT_THAT(report->caseResults.records[0].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Pass));
+}
+
+TEST_F(RSTestLibAsyncTest, noProgressWithoutPoll)
+{
+    TestCase_t RSTC_Async[] = {TESTCASE_ASYNC_DEF(RSTC_async_never, TestCaseState_Idle),
+                               TESTCASE_ASYNC_DEF(RSTC_async_wait2, TestCaseState_Disabled)};
+
+    m_testSuite.testCases = &(RSTC_Async[0]);
+    m_testSuite.count     = ARRAY_SIZE(RSTC_Async);
+
+    // Expectations
+    EXPECT_CALL(m_startupCb, Call()).Times(1);
+    EXPECT_CALL(m_teardownCb, Call()).Times(1);
+    EXPECT_CALL(m_failureCb, Call(_)).Times(1);
+
+    // Execution
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+    const auto *report = rstest_getReport();
+    checkReportValidity(report);
+
+    EXPECT_THAT(report->disabledCount, Eq(1));
+    EXPECT_THAT(report->failCount, Eq(1));
+}
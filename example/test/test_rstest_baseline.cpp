@@ -0,0 +1,190 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_baseline.h>
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestBaselineTest : public Test
+{
+public:
+    /// Constructor
+    RSTestBaselineTest()
+    {
+        m_testSuite.name          = "BaselineSuite";
+        m_testSuite.testCases     = &(m_testCases[0]);
+        m_testSuite.count         = ARRAY_SIZE(m_testCases);
+        m_testSuite.startupCb     = &RSTestBaselineTest::startupCallback;
+        m_testSuite.startupCbUser = this;
+        m_testSuite.clockCb       = &RSTestBaselineTest::clockCallback;
+        m_testSuite.clockCbUser   = this;
+
+        m_baseline.entries = &(m_entries[0]);
+        m_baseline.count   = ARRAY_SIZE(m_entries);
+        m_baseline.noise   = TestNoiseModel_t RSTEST_NOISE_MODEL_DEFAULT;
+    }
+
+protected:
+    /// Startup Callback - the simulated cost of the next test case.
+    static void startupCallback(void *user)
+    {
+        auto that = reinterpret_cast<RSTestBaselineTest *>(user);
+        that->m_now += that->m_costs.at(that->m_next % that->m_costs.size());
+        that->m_next++;
+    }
+
+    /// Clock Callback - simulated clock.
+    static uint64_t clockCallback(void *user) { return reinterpret_cast<RSTestBaselineTest *>(user)->m_now; }
+
+    TestCase_t          m_testCases[2] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                          TESTCASE_DEF(RSTC_pass_assert_pass_end, TestCaseState_Idle)};
+    TestBaselineEntry_t m_entries[2]   = {{"RSTC_pass_end", 100U}, {"RSTC_pass_assert_pass_end", 100U}};
+    TestBaseline_t      m_baseline{};  ///< Baseline of the test cases
+    TestSuite_t         m_testSuite{}; ///< TestSuite to use for this test.
+    vector<uint64_t>    m_costs;       ///< Simulated cost per test case execution
+    size_t              m_next = 0U;   ///< Next test case execution
+    uint64_t            m_now  = 0U;   ///< Simulated clock
+};
+
+TEST_F(RSTestBaselineTest, durationsWithoutBaseline)
+{
+    m_costs = {100U, 250U};
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+
+    const auto *report = rstest_getReport();
+    EXPECT_THAT(report->regressionCount, Eq(0U));
+    EXPECT_THAT(report->caseResults.records[0].duration, Eq(100U));
+    EXPECT_THAT(report->caseResults.records[0].durationRuns, Eq(1U));
+    EXPECT_THAT(report->caseResults.records[1].duration, Eq(250U));
+}
+
+TEST_F(RSTestBaselineTest, regressionIsDistinctFailure)
+{
+    m_costs                           = {110U, 111U}; // Within 10% and beyond it.
+    m_testSuite.baseline              = &m_baseline;
+    m_baseline.noise.minDelta         = 5U;
+    m_baseline.noise.relativePermille = 100U;
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+
+    const auto *report = rstest_getReport();
+    EXPECT_THAT(report->passCount, Eq(2U));
+    EXPECT_THAT(report->failCount, Eq(0U));
+    EXPECT_THAT(report->regressionCount, Eq(1U));
+    EXPECT_THAT(report->caseResults.records[0].regressed, IsFalse());
+    EXPECT_THAT(report->caseResults.records[1].regressed, IsTrue());
+}
+
+TEST_F(RSTestBaselineTest, minimumDeltaAllowed)
+{
+    m_costs                   = {150U, 150U};
+    m_testSuite.baseline      = &m_baseline;
+    m_baseline.noise.minDelta = 50U;
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(rstest_getReport()->regressionCount, Eq(0U));
+}
+
+TEST_F(RSTestBaselineTest, minimumOverRepeatedRuns)
+{
+    m_costs                  = {300U, 300U, 100U, 100U}; // Noisy first run.
+    m_testSuite.baseline     = &m_baseline;
+    m_baseline.noise.minRuns = 2U;
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_getReport()->regressionCount, Eq(0U)); // Not judged yet
+
+    EXPECT_THAT(rstest_run(), IsTrue());
+    const auto *report = rstest_getReport();
+    EXPECT_THAT(report->regressionCount, Eq(0U));
+    EXPECT_THAT(report->caseResults.records[0].duration, Eq(100U));
+    EXPECT_THAT(report->caseResults.records[0].durationRuns, Eq(2U));
+
+    m_costs              = {400U}; // Consistently slower.
+    m_testCases[0].state = TestCaseState_Idle;
+    m_testCases[1].state = TestCaseState_Idle;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_getReport()->regressionCount, Eq(2U));
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_F(RSTestBaselineTest, saveAndLoad)
+{
+    const string path = ::testing::TempDir() + "rstest_baseline_test.txt";
+    m_costs           = {120U, 80U};
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    ASSERT_THAT(rstest_baselineSave(rstest_getReport(), path.c_str()), IsTrue());
+
+    TestBaselineFile_t file{};
+    ASSERT_THAT(rstest_baselineLoad(&file, path.c_str()), IsTrue());
+    ASSERT_THAT(file.baseline.count, Eq(2U));
+    EXPECT_THAT(file.baseline.entries, Eq(&(file.entries[0])));
+    EXPECT_THAT(file.entries[0].name, StrEq("RSTC_pass_end"));
+    EXPECT_THAT(file.entries[0].duration, Eq(120U));
+    EXPECT_THAT(file.entries[1].name, StrEq("RSTC_pass_assert_pass_end"));
+    EXPECT_THAT(file.entries[1].duration, Eq(80U));
+
+    // Compare the next run with the loaded baseline.
+    m_costs              = {120U, 200U};
+    m_testSuite.baseline = &(file.baseline);
+    m_testCases[0].state = TestCaseState_Idle;
+    m_testCases[1].state = TestCaseState_Idle;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_getReport()->caseResults.records[1].regressed, IsTrue());
+
+    {
+        ofstream malformed(path);
+        malformed << "RSTC_pass_end not_a_duration\n";
+    }
+    EXPECT_THAT(rstest_baselineLoad(&file, path.c_str()), IsFalse());
+    (void)remove(path.c_str());
+    EXPECT_THAT(rstest_baselineLoad(&file, path.c_str()), IsFalse());
+}
+
+TEST(RSTestBaselineHostTest, monotonicClock)
+{
+    const uint64_t first = rstest_hostClockNs(nullptr);
+    EXPECT_THAT(rstest_hostClockNs(nullptr), Ge(first));
+}
+#endif
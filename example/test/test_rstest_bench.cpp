@@ -0,0 +1,214 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_baseline.h>
+
+#include <gmock/gmock.h>
+
+#include <string>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestBenchTest : public Test
+{
+public:
+    /// Constructor
+    RSTestBenchTest()
+    {
+        m_testSuite.name        = "BenchSuite";
+        m_testSuite.testCases   = &(m_testCases[0]);
+        m_testSuite.count       = ARRAY_SIZE(m_testCases);
+        m_testSuite.clockCb     = &RSTestBenchTest::clockCallback;
+        m_testSuite.clockCbUser = this;
+    }
+
+protected:
+    /// Clock Callback - the simulated time.
+    static uint64_t clockCallback(void *user) { return reinterpret_cast<RSTestBenchTest *>(user)->m_now; }
+
+    /// Old implementation - takes m_oldTicks.
+    static void oldImpl(void *user)
+    {
+        auto *self = reinterpret_cast<RSTestBenchTest *>(user);
+        self->m_now += self->m_oldTicks;
+        self->m_calls += "A";
+    }
+
+    /// New implementation - takes m_newTicks, alternating with m_newTicks2 when set.
+    static void newImpl(void *user)
+    {
+        auto *self = reinterpret_cast<RSTestBenchTest *>(user);
+        self->m_now += ((self->m_newTicks2 != 0U) && ((self->m_calls.size() % 4U) >= 2U)) ? self->m_newTicks2
+                                                                                            : self->m_newTicks;
+        self->m_calls += "B";
+    }
+
+    /// Result of the benchmark test case after the run.
+    [[nodiscard]] static const TestCaseResult_t &result() { return rstest_getReport()->caseResults.records[1]; }
+
+    TestBenchResult_t m_ratio{};     ///< Ratio of the benchmark
+    TestBenchAB_t     m_bench{&RSTestBenchTest::oldImpl, &RSTestBenchTest::newImpl, this, 8U, 1U, 50U, 0U, &m_ratio};
+    TestCase_t        m_testCases[2] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                        TESTCASE_BENCH_DEF(RSTC_bench, m_bench, TestCaseState_Idle)};
+    TestSuite_t       m_testSuite{};     ///< TestSuite to use for this test.
+    uint64_t          m_now       = 0U;  ///< Simulated time
+    uint64_t          m_oldTicks  = 100U; ///< Duration of the old implementation
+    uint64_t          m_newTicks  = 90U;  ///< Duration of the new implementation
+    uint64_t          m_newTicks2 = 0U;   ///< Alternate duration of the new implementation, 0 for none
+    string            m_calls;            ///< Implementations called in order
+};
+
+TEST_F(RSTestBenchTest, reportsRatio)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().name, StrEq("RSTC_bench"));
+    EXPECT_THAT(result().state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(m_ratio.pairs, Eq(8U));
+    EXPECT_THAT(m_ratio.ratioPermille, Eq(900U));
+    EXPECT_THAT(m_ratio.ciLowPermille, Eq(900U));
+    EXPECT_THAT(m_ratio.ciHighPermille, Eq(900U));
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+}
+
+TEST_F(RSTestBenchTest, checksWithoutResult)
+{
+    m_bench.result            = nullptr;
+    m_bench.minFasterPermille = 200U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_ratio.pairs, Eq(0U));
+}
+
+TEST_F(RSTestBenchTest, failsBelowSpeedup)
+{
+    m_bench.minFasterPermille = 200U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_ratio.ratioPermille, Eq(900U));
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+}
+
+TEST_F(RSTestBenchTest, interleavesRandomizedOrder)
+{
+    m_bench.pairs = 32U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    // Warm up then each pair calls both implementations, in either order.
+    ASSERT_THAT(m_calls.size(), Eq(2U + (2U * 32U)));
+    EXPECT_THAT(m_calls.substr(0U, 2U), StrEq("AB"));
+    size_t oldFirst = 0U;
+    for (size_t idx = 2U; idx < m_calls.size(); idx += 2U)
+    {
+        const string pair = m_calls.substr(idx, 2U);
+        EXPECT_THAT(pair, AnyOf(StrEq("AB"), StrEq("BA")));
+        oldFirst += (pair == "AB") ? 1U : 0U;
+    }
+    EXPECT_THAT(oldFirst, AllOf(Gt(0U), Lt(32U)));
+}
+
+TEST_F(RSTestBenchTest, failsWhenIntervalIncludesSlower)
+{
+    // New takes 80 or 120 ticks - the same on average, not confidently faster.
+    m_newTicks                = 80U;
+    m_newTicks2               = 120U;
+    m_bench.pairs             = 16U;
+    m_bench.minFasterPermille = 0U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_ratio.ciLowPermille, Lt(m_ratio.ratioPermille));
+    EXPECT_THAT(m_ratio.ciHighPermille, Gt(1000U));
+}
+
+TEST_F(RSTestBenchTest, reportsOnlyWithoutCheck)
+{
+    m_newTicks                = 80U;
+    m_newTicks2               = 120U;
+    m_bench.minFasterPermille = RSTEST_BENCH_NO_CHECK;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(m_ratio.ciLowPermille, Lt(1000U));
+}
+
+TEST_F(RSTestBenchTest, failsWithoutClock)
+{
+    m_testSuite.clockCb = nullptr;
+    m_ratio.pairs       = 1U; // Overwritten by the execution.
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_ratio.pairs, Eq(0U));
+}
+
+TEST_F(RSTestBenchTest, skipsPairsBelowResolution)
+{
+    // New takes 0 (below the clock resolution) or 90 ticks - only the measured pairs count.
+    m_newTicks    = 0U;
+    m_newTicks2   = 90U;
+    m_bench.pairs = 16U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(m_ratio.pairs, AllOf(Ge(2U), Lt(16U)));
+    EXPECT_THAT(m_ratio.ratioPermille, Eq(900U));
+}
+
+TEST_F(RSTestBenchTest, failsWithoutImplementation)
+{
+    m_bench.newFunc = nullptr;
+    m_ratio.pairs   = 1U; // Overwritten by the execution.
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_ratio.pairs, Eq(0U));
+    EXPECT_THAT(m_calls, IsEmpty());
+}
+
+TEST_F(RSTestBenchTest, measuresExampleOnHostClock)
+{
+    m_testCases[1]          = TESTCASE_BENCH_DEF(RSTC_bench_popcount, RSTC_bench_popcount, TestCaseState_Idle);
+    m_testSuite.clockCb     = &rstest_hostClockNs;
+    m_testSuite.clockCbUser = nullptr;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Pass));
+    const TestBenchResult_t &ratio = RSTC_benchPopcountRatio;
+    EXPECT_THAT(ratio.pairs, Eq(16U));
+    EXPECT_THAT(ratio.ciLowPermille, Le(ratio.ratioPermille));
+    EXPECT_THAT(ratio.ciHighPermille, Ge(ratio.ratioPermille));
+}
@@ -0,0 +1,207 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_budget.h>
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestBudgetTest : public Test
+{
+public:
+    /// Constructor
+    RSTestBudgetTest()
+    {
+        m_testSuite.name          = "BudgetSuite";
+        m_testSuite.testCases     = &(m_testCases[0]);
+        m_testSuite.count         = ARRAY_SIZE(m_testCases);
+        m_testSuite.startupCb     = &RSTestBudgetTest::startupCallback;
+        m_testSuite.startupCbUser = this;
+        m_testSuite.clockCb       = &RSTestBudgetTest::clockCallback;
+        m_testSuite.clockCbUser   = this;
+    }
+
+protected:
+    /// Clock Callback - the simulated time.
+    static uint64_t clockCallback(void *user) { return reinterpret_cast<RSTestBudgetTest *>(user)->m_now; }
+
+    /// Startup Callback - each test case takes 100 ticks.
+    static void startupCallback(void *user) { reinterpret_cast<RSTestBudgetTest *>(user)->m_now += 100U; }
+
+    /// State of a test case after the run.
+    /// @param[in] idx index of the test case
+    [[nodiscard]] static TestCaseState_t state(size_t idx)
+    {
+        return rstest_getReport()->caseResults.records[idx].state;
+    }
+
+    TestCase_t         m_testCases[3] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                         TESTCASE_DEF(RSTC_fail_end, TestCaseState_Idle),
+                                         TESTCASE_DEF(RSTC_pass_assert_pass_end, TestCaseState_Idle)};
+    TestSuite_t        m_testSuite{}; ///< TestSuite to use for this test.
+    uint64_t           m_now = 0U;    ///< Simulated time
+    TestHistoryEntry_t m_entries[2]   = {{"RSTC_pass_end", 50U, 0U, true}, {"RSTC_fail_end", 50U, 1U, false}};
+    TestHistory_t      m_history{&(m_entries[0]), ARRAY_SIZE(m_entries)};
+};
+
+TEST_F(RSTestBudgetTest, scoresFailuresAndChanges)
+{
+    const TestHistoryEntry_t lastFailed{"tc", 0U, 0x1U, false};
+    const TestHistoryEntry_t olderFailed{"tc", 0U, 0x6U, false};
+    const TestHistoryEntry_t changed{"tc", 0U, 0x0U, true};
+    const TestHistoryEntry_t both{"tc", 0U, 0x101U, true};
+
+    EXPECT_THAT(rstest_budgetScore(nullptr), Eq(RSTEST_BUDGET_SCORE_CHANGED));
+    EXPECT_THAT(rstest_budgetScore(&lastFailed), Eq(128U));
+    EXPECT_THAT(rstest_budgetScore(&olderFailed), Eq(64U + 32U));
+    EXPECT_THAT(rstest_budgetScore(&changed), Eq(RSTEST_BUDGET_SCORE_CHANGED));
+    EXPECT_THAT(rstest_budgetScore(&both), Eq(RSTEST_BUDGET_SCORE_CHANGED + 128U));
+}
+
+TEST_F(RSTestBudgetTest, defersLowestPriority)
+{
+    // New and changed first (new is shorter), the failing test case does not fit.
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_runBudget(200U, &m_history), IsTrue());
+
+    EXPECT_THAT(state(0U), Eq(TestCaseState_Pass));
+    EXPECT_THAT(state(1U), Eq(TestCaseState_Deferred));
+    EXPECT_THAT(state(2U), Eq(TestCaseState_Pass));
+    EXPECT_THAT(rstest_getReport()->deferredCount, Eq(1U));
+    EXPECT_THAT(rstest_getReport()->executedCount, Eq(2U));
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+}
+
+TEST_F(RSTestBudgetTest, executesRecentFailureFirst)
+{
+    m_entries[0].changed = false;
+    m_entries[1].changed = true;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_runBudget(100U, &m_history), IsTrue());
+
+    EXPECT_THAT(state(0U), Eq(TestCaseState_Deferred));
+    EXPECT_THAT(state(1U), Eq(TestCaseState_Fail));
+    EXPECT_THAT(state(2U), Eq(TestCaseState_Deferred));
+    EXPECT_THAT(rstest_getReport()->deferredCount, Eq(2U));
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+}
+
+TEST_F(RSTestBudgetTest, skipsTestCaseLongerThanTimeLeft)
+{
+    // RSTC_pass_end expected to take longer than the time left - the shorter one still executes.
+    m_entries[0].duration = 500U;
+    m_entries[1].changed  = true;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_runBudget(300U, &m_history), IsTrue());
+
+    EXPECT_THAT(state(0U), Eq(TestCaseState_Deferred));
+    EXPECT_THAT(state(1U), Eq(TestCaseState_Fail));
+    EXPECT_THAT(state(2U), Eq(TestCaseState_Pass));
+}
+
+TEST_F(RSTestBudgetTest, executesPrerequisiteFirst)
+{
+    static const char *const k_needsPass[] = {"RSTC_pass_end", nullptr};
+    m_testCases[1].depends                 = k_needsPass;
+    m_entries[1].changed                   = true;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_runBudget(1000U, &m_history), IsTrue());
+
+    EXPECT_THAT(state(0U), Eq(TestCaseState_Pass));
+    EXPECT_THAT(state(1U), Eq(TestCaseState_Fail));
+    EXPECT_THAT(state(2U), Eq(TestCaseState_Pass));
+    EXPECT_THAT(rstest_getReport()->deferredCount, Eq(0U));
+}
+
+TEST_F(RSTestBudgetTest, blocksOnNeverEndedPrerequisite)
+{
+    static const char *const k_needsNoEnd[] = {"RSTC_no_end", nullptr};
+    m_testCases[0]                          = TESTCASE_DEF(RSTC_no_end, TestCaseState_Idle);
+    m_testCases[2].depends                  = k_needsNoEnd;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_runBudget(1000U, &m_history), IsTrue());
+
+    EXPECT_THAT(state(0U), Eq(TestCaseState_Fail));
+    EXPECT_THAT(state(2U), Eq(TestCaseState_Blocked));
+    EXPECT_THAT(rstest_getReport()->blockedCount, Eq(1U));
+    EXPECT_THAT(rstest_getReport()->deferredCount, Eq(0U));
+}
+
+TEST_F(RSTestBudgetTest, needsClock)
+{
+    m_testSuite.clockCb = nullptr;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_runBudget(1000U, &m_history), IsFalse());
+}
+
+TEST_F(RSTestBudgetTest, savesAndLoadsHistory)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_runBudget(200U, &m_history), IsTrue());
+
+    const string path = TempDir() + "rstest.history";
+    ASSERT_THAT(rstest_historySave(rstest_getReport(), &m_history, path.c_str()), IsTrue());
+    ifstream     file(path);
+    stringstream content;
+    content << file.rdbuf();
+    // RSTC_fail_end deferred keeps its history.
+    EXPECT_THAT(content.str(), StrEq("# rstest history: BudgetSuite\n"
+                                     "RSTC_pass_end 100 0\n"
+                                     "RSTC_fail_end 50 1\n"
+                                     "RSTC_pass_assert_pass_end 100 0\n"));
+
+    TestHistoryFile_t loaded{};
+    ASSERT_THAT(rstest_historyLoad(&loaded, path.c_str()), IsTrue());
+    ASSERT_THAT(loaded.history.count, Eq(3U));
+    EXPECT_THAT(loaded.history.entries[1].name, StrEq("RSTC_fail_end"));
+    EXPECT_THAT(loaded.history.entries[1].duration, Eq(50U));
+    EXPECT_THAT(loaded.history.entries[1].failures, Eq(1U));
+    EXPECT_THAT(loaded.history.entries[1].changed, IsFalse());
+
+    rstest_historyChanged("RSTC_fail_end", &loaded);
+    rstest_historyChanged("RSTC_new", &loaded);
+    ASSERT_THAT(loaded.history.count, Eq(4U));
+    EXPECT_THAT(loaded.history.entries[1].changed, IsTrue());
+    EXPECT_THAT(loaded.history.entries[3].name, StrEq("RSTC_new"));
+    EXPECT_THAT(loaded.history.entries[3].changed, IsTrue());
+    (void)remove(path.c_str());
+}
+
+TEST_F(RSTestBudgetTest, rejectsMalformedHistory)
+{
+    const string path = TempDir() + "rstest_bad.history";
+    {
+        ofstream file(path);
+        file << "RSTC_pass_end 100\n";
+    }
+    TestHistoryFile_t loaded{};
+    EXPECT_THAT(rstest_historyLoad(&loaded, path.c_str()), IsFalse());
+    (void)remove(path.c_str());
+}
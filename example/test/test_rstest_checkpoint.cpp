@@ -0,0 +1,214 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_checkpoint.h>
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace ::std;
+using namespace ::testing;
+
+namespace
+{
+/// Executions of the test cases.
+uint32_t k_executions = 0U;
+/// Checkpoint store copied when the third test case executes - a reset at that point.
+TestCheckpoint_t k_atReset{};
+/// No-init RAM of the checkpoint store.
+TestCheckpoint_t k_ram{};
+
+/// Code under test - copies the checkpoint when the third test case executes.
+void countExecution()
+{
+    if (++k_executions == 3U)
+    {
+        k_atReset = k_ram;
+    }
+}
+} // namespace
+
+//-----------------------------------------------------------------------------
+class RSTestCheckpointTest : public Test
+{
+public:
+    /// Constructor
+    RSTestCheckpointTest()
+    {
+        m_testSuite.name      = "CheckpointSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+        k_executions          = 0U;
+        k_ram                 = TestCheckpoint_t{};
+        RSTC_callback         = countExecution;
+        rstest_setCheckpoint(&m_store);
+    }
+
+    /// Destructor - stop checkpointing.
+    ~RSTestCheckpointTest() override
+    {
+        rstest_setCheckpoint(nullptr);
+        RSTC_callback = nullptr;
+    }
+
+protected:
+    /// Initialize the test suite as after a reset - every test case Idle.
+    void reset()
+    {
+        for (auto &testCase : m_testCases)
+        {
+            testCase.state = TestCaseState_Idle;
+        }
+        ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+        k_executions = 0U;
+    }
+
+    TestCase_t            m_testCases[5] = {TESTCASE_DEF(RSTC_callback_pass, TestCaseState_Idle),
+                                            TESTCASE_DEF(RSTC_fail_end, TestCaseState_Idle),
+                                            TESTCASE_DEF(RSTC_callback_pass, TestCaseState_Idle),
+                                            TESTCASE_DEF(RSTC_callback_pass, TestCaseState_Idle),
+                                            TESTCASE_DEF(RSTC_callback_pass, TestCaseState_Idle)};
+    TestSuite_t           m_testSuite{}; ///< TestSuite to use for this test.
+    TestCheckpointStore_t m_store{&rstest_checkpointRamWrite, &rstest_checkpointRamRead, &k_ram};
+};
+
+TEST_F(RSTestCheckpointTest, crc32)
+{
+    EXPECT_THAT(rstest_checkpointCrc("123456789", 9U), Eq(0xCBF43926U));
+    EXPECT_THAT(rstest_checkpointCrc(nullptr, 0U), Eq(0U));
+}
+
+TEST_F(RSTestCheckpointTest, nothingToResume)
+{
+    reset();
+    EXPECT_THAT(rstest_resume(), IsFalse()); // Never written.
+
+    ASSERT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(k_ram.complete, Ne(0U));
+    reset();
+    EXPECT_THAT(rstest_resume(), IsFalse()); // Completed.
+}
+
+TEST_F(RSTestCheckpointTest, resumeAfterReset)
+{
+    reset();
+    ASSERT_THAT(rstest_run(), IsTrue());
+    const TestReport_t expected = *rstest_getReport();
+    ASSERT_THAT(k_executions, Eq(4U));
+
+    // Reset while the fourth test case (third execution) executed.
+    k_ram = k_atReset;
+    reset();
+    ASSERT_THAT(rstest_resume(), IsTrue());
+    ASSERT_THAT(rstest_run(), IsTrue());
+
+    // Only the last test case executes again, the interrupted one fails.
+    EXPECT_THAT(k_executions, Eq(1U));
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->testCount, Eq(expected.testCount));
+    EXPECT_THAT(report->executedCount, Eq(expected.executedCount));
+    EXPECT_THAT(report->passCount, Eq(expected.passCount - 1U));
+    EXPECT_THAT(report->failCount, Eq(expected.failCount + 1U));
+    EXPECT_THAT(report->caseResults.records[0].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(report->caseResults.records[2].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(report->caseResults.records[3].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(report->caseResults.records[4].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(report->failAsserts.count, Eq(1U)); // Only the interrupted one - earlier records are lost.
+}
+
+TEST_F(RSTestCheckpointTest, neverEndedSavedFailed)
+{
+    m_testCases[1] = TESTCASE_DEF(RSTC_no_end, TestCaseState_Idle);
+    reset();
+    ASSERT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(k_atReset.states[1], Eq(TestCaseState_Fail));
+
+    // Resumed as failed rather than interrupted - only the fourth test case is.
+    k_ram = k_atReset;
+    reset();
+    ASSERT_THAT(rstest_resume(), IsTrue());
+    ASSERT_THAT(rstest_run(), IsTrue());
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(report->caseResults.records[3].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(report->failAsserts.count, Eq(1U));
+}
+
+TEST_F(RSTestCheckpointTest, suiteTooLarge)
+{
+    // More test cases than a checkpoint holds - not run rather than not resumable.
+    vector<TestCase_t> testCases(RSTEST_CHECKPOINT_MAX_CASES + 1U, m_testCases[0]);
+    m_testSuite.testCases = testCases.data();
+    m_testSuite.count     = testCases.size();
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsFalse());
+    EXPECT_THAT(k_executions, Eq(0U));
+    EXPECT_THAT(k_ram.magic, Eq(0U));
+
+    rstest_setCheckpoint(nullptr);
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(k_executions, Eq(testCases.size()));
+}
+
+TEST_F(RSTestCheckpointTest, invalidCheckpointNotResumed)
+{
+    reset();
+    ASSERT_THAT(rstest_run(), IsTrue());
+
+    k_ram = k_atReset;
+    k_ram.states[0]++; // Corrupt
+    reset();
+    EXPECT_THAT(rstest_resume(), IsFalse());
+
+    k_ram               = k_atReset;
+    m_testCases[4].name = "RSTC_other";
+    reset();
+    EXPECT_THAT(rstest_resume(), IsFalse()); // Different test suite.
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_F(RSTestCheckpointTest, fileBackend)
+{
+    string                path = ::testing::TempDir() + "rstest_checkpoint_test.bin";
+    TestCheckpointStore_t file{&rstest_checkpointFileWrite, &rstest_checkpointFileRead, path.data()};
+    (void)remove(path.c_str());
+    rstest_setCheckpoint(&file);
+
+    reset();
+    EXPECT_THAT(rstest_resume(), IsFalse());
+    ASSERT_THAT(rstest_run(), IsTrue());
+
+    TestCheckpoint_t read{};
+    ASSERT_THAT(rstest_checkpointFileRead(&read, path.data()), IsTrue());
+    EXPECT_THAT(read.magic, Eq(RSTEST_CHECKPOINT_MAGIC));
+    EXPECT_THAT(read.complete, Ne(0U));
+    EXPECT_THAT(read.caseCount, Eq(ARRAY_SIZE(m_testCases)));
+    (void)remove(path.c_str());
+    EXPECT_THAT(rstest_checkpointFileRead(&read, path.data()), IsFalse());
+}
+#endif // defined(__unix__) || defined(__APPLE__)
@@ -0,0 +1,259 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_coverage.h>
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ::std;
+using namespace ::testing;
+
+#if defined(__unix__) || defined(__APPLE__)
+
+//-----------------------------------------------------------------------------
+class RSTestCoverageSelectTest : public Test
+{
+protected:
+    /// Select test cases from a coverage map with a diff.
+    /// @param[in] map content of the coverage map
+    /// @param[in] diff content of the unified diff
+    /// @returns names of the selected test cases
+    static vector<string> select(const string &map, const string &diff)
+    {
+        const string mapPath  = ::testing::TempDir() + "rstest_coverage_test.map";
+        const string diffPath = ::testing::TempDir() + "rstest_coverage_test.diff";
+        ofstream(mapPath) << map;
+        ofstream(diffPath) << diff;
+
+        vector<string> names;
+        EXPECT_THAT(rstest_coverageSelect(
+                        mapPath.c_str(), diffPath.c_str(),
+                        [](const char *name, void *user) { static_cast<vector<string> *>(user)->emplace_back(name); },
+                        &names),
+                    IsTrue());
+        (void)remove(mapPath.c_str());
+        (void)remove(diffPath.c_str());
+        return names;
+    }
+
+    /// Guards 1-3 in src/a.c lines 10, 20 and src/b.c line 5.
+    /// caseA hits guard 1, caseB guards 2 and 3, caseC none.
+    const string m_map = "# rstest coverage map: suite\n"
+                         "G 1 /work/src/a.c:10\n"
+                         "G 2 /work/src/a.c:20\n"
+                         "G 3 /work/src/b.c:5\n"
+                         "C caseA 2\n"
+                         "C caseB c\n"
+                         "C caseC 0\n";
+};
+
+TEST_F(RSTestCoverageSelectTest, changedLines)
+{
+    EXPECT_THAT(select(m_map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -10 +10 @@\n"), ElementsAre("caseA"));
+    EXPECT_THAT(select(m_map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -15,6 +15,2 @@\n"), ElementsAre("caseB"));
+    EXPECT_THAT(select(m_map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -1,2 +1,2 @@\n--- a/src/b.c\n+++ b/src/b.c\n"
+                              "@@ -4,0 +5 @@\n"),
+                ElementsAre("caseB"));
+    EXPECT_THAT(select(m_map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -9,12 +9,12 @@\n"), ElementsAre("caseA", "caseB"));
+}
+
+TEST_F(RSTestCoverageSelectTest, unchangedLines)
+{
+    EXPECT_THAT(select(m_map, ""), IsEmpty());
+    EXPECT_THAT(select(m_map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -11,9 +11,9 @@\n"), IsEmpty());
+    // Path must match whole components and new files have no covered lines.
+    EXPECT_THAT(select(m_map, "--- a/rc/a.c\n+++ b/rc/a.c\n@@ -10 +10 @@\n"), IsEmpty());
+    EXPECT_THAT(select(m_map, "--- /dev/null\n+++ b/src/c.c\n@@ -0,0 +1,5 @@\n"), IsEmpty());
+}
+
+TEST_F(RSTestCoverageSelectTest, functionRanges)
+{
+    // Guards are recorded with the lines of their function - any line of it selects.
+    const string map = "# rstest coverage map: suite\n"
+                       "G 1 /work/src/a.c:10-14\n"
+                       "G 2 /work/src/a.c:16-30\n"
+                       "C caseA 2\n"
+                       "C caseB 4\n";
+    EXPECT_THAT(select(map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -12 +12 @@\n"), ElementsAre("caseA"));
+    EXPECT_THAT(select(map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -30 +30 @@\n"), ElementsAre("caseB"));
+    EXPECT_THAT(select(map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -13,4 +13,4 @@\n"), ElementsAre("caseA", "caseB"));
+    EXPECT_THAT(select(map, "--- a/src/a.c\n+++ b/src/a.c\n@@ -15 +15 @@\n"), IsEmpty());
+}
+
+TEST_F(RSTestCoverageSelectTest, malformedMap)
+{
+    const string path = ::testing::TempDir() + "rstest_coverage_test.map";
+    ofstream(path) << "X 1 2\n";
+    EXPECT_THAT(rstest_coverageSelect(path.c_str(), path.c_str(), [](const char *, void *) {}, nullptr), IsFalse());
+    EXPECT_THAT(rstest_coverageSelect(path.c_str(), nullptr, [](const char *, void *) {}, nullptr), IsFalse());
+    (void)remove(path.c_str());
+    EXPECT_THAT(rstest_coverageSelect(path.c_str(), path.c_str(), [](const char *, void *) {}, nullptr), IsFalse());
+}
+
+#endif // defined(__unix__) || defined(__APPLE__)
+
+#if defined(RSTEST_COVERAGE_MAP)
+
+extern "C"
+{
+    void __sanitizer_cov_trace_pc_guard_init(uint32_t *start, uint32_t *stop);
+    void __sanitizer_cov_trace_pc_guard(uint32_t *guard);
+}
+
+namespace
+{
+/// Guards of the code under test - numbered once by the guard init callback.
+uint32_t k_guards[3] = {0U};
+/// Source line of the guard hit by caseB only.
+uint32_t k_caseBLine = 0U;
+
+/// Code under test - instrumented by hand, the first execution hits guard 0,
+/// later executions guards 1 and 2.
+void codeUnderTest()
+{
+    static uint32_t executions = 0U;
+    if (executions++ == 0U)
+    {
+        __sanitizer_cov_trace_pc_guard(&k_guards[0]);
+    }
+    else
+    {
+        __sanitizer_cov_trace_pc_guard(&k_guards[1]);
+        k_caseBLine = __LINE__ - 1U;
+        __sanitizer_cov_trace_pc_guard(&k_guards[2]);
+    }
+}
+} // namespace
+
+//-----------------------------------------------------------------------------
+class RSTestCoverageTest : public Test
+{
+public:
+    /// Constructor
+    RSTestCoverageTest()
+    {
+        __sanitizer_cov_trace_pc_guard_init(&k_guards[0], &k_guards[ARRAY_SIZE(k_guards)]);
+        m_testCases[0].name   = "caseA";
+        m_testCases[1].name   = "caseB";
+        m_testSuite.name      = "CoverageSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+        RSTC_callback         = codeUnderTest;
+    }
+
+    /// Destructor - stop executing the code under test.
+    ~RSTestCoverageTest() override { RSTC_callback = nullptr; }
+
+protected:
+    TestCase_t  m_testCases[2] = {TESTCASE_DEF(RSTC_callback_pass, TestCaseState_Idle),
+                                  TESTCASE_DEF(RSTC_callback_pass, TestCaseState_Idle)};
+    TestSuite_t m_testSuite{}; ///< TestSuite to use for this test.
+};
+
+TEST_F(RSTestCoverageTest, recordsAndSelects)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    ASSERT_THAT(rstest_run(), IsTrue());
+
+    // Guards are numbered after those of any instrumented code.
+    const uint32_t first = k_guards[0];
+    ASSERT_THAT(first, Ne(0U));
+    EXPECT_THAT(rstest_coverageGuardCount(), Ge(first + 2U));
+    EXPECT_THAT(k_guards[2], Eq(first + 2U));
+    EXPECT_THAT(rstest_coverageHit(0U, first), IsTrue());
+    EXPECT_THAT(rstest_coverageHit(0U, first + 1U), IsFalse());
+    EXPECT_THAT(rstest_coverageHit(1U, first), IsFalse());
+    EXPECT_THAT(rstest_coverageHit(1U, first + 1U), IsTrue());
+    EXPECT_THAT(rstest_coverageHit(1U, first + 2U), IsTrue());
+    EXPECT_THAT(rstest_coverageHit(MAX_NUM_TESTCASE_RESULTS, first), IsFalse());
+
+    const string mapPath = ::testing::TempDir() + "rstest_coverage_test.map";
+    ASSERT_THAT(rstest_coverageSave(rstest_getReport(), mapPath.c_str()), IsTrue());
+    stringstream content;
+    content << ifstream(mapPath).rdbuf();
+    EXPECT_THAT(content.str(), StartsWith("# rstest coverage map: CoverageSuite\n"));
+    // Without debug info addr2line has no line of the guard ("file:?" or "??:0") - nothing to select by.
+    const string map   = content.str();
+    const string guard = "\nG " + to_string(first) + " ";
+    const size_t at    = map.find(guard);
+    ASSERT_THAT(at, Ne(string::npos));
+    const size_t start    = at + guard.size();
+    const string location = map.substr(start, map.find('\n', start) - start);
+    if (location.ends_with(":?") || location.ends_with(":0"))
+    {
+        (void)remove(mapPath.c_str());
+        GTEST_SKIP() << "Built without debug info - no source lines in the coverage map";
+    }
+    EXPECT_THAT(content.str(), ContainsRegex("test_rstest_coverage\\.cpp:[0-9]+-[0-9]+\n"));
+    EXPECT_THAT(content.str(), HasSubstr("\nC caseA "));
+    EXPECT_THAT(content.str(), HasSubstr("\nC caseB "));
+
+    // A change to any line of the code under test selects the test cases executing it:
+    // the line of a guard and a line within a block (not the first of it).
+    const string diffPath = ::testing::TempDir() + "rstest_coverage_test.diff";
+    for (const uint32_t line : {k_caseBLine, k_caseBLine + 1U})
+    {
+        ofstream(diffPath) << "--- a/example/test/test_rstest_coverage.cpp\n"
+                           << "+++ b/example/test/test_rstest_coverage.cpp\n"
+                           << "@@ -" << line << " +" << line << " @@\n";
+        vector<string> names;
+        EXPECT_THAT(rstest_coverageSelect(
+                        mapPath.c_str(), diffPath.c_str(),
+                        [](const char *name, void *user) { static_cast<vector<string> *>(user)->emplace_back(name); },
+                        &names),
+                    IsTrue());
+        EXPECT_THAT(names, ElementsAre("caseA", "caseB")) << "line " << line;
+    }
+    (void)remove(mapPath.c_str());
+    (void)remove(diffPath.c_str());
+}
+
+TEST_F(RSTestCoverageTest, suiteTooLarge)
+{
+    // Coverage beyond MAX_NUM_TESTCASE_RESULTS test cases is not recorded - no partial map is saved.
+    vector<TestCase_t> testCases(MAX_NUM_TESTCASE_RESULTS + 1U, m_testCases[0]);
+    m_testSuite.testCases = testCases.data();
+    m_testSuite.count     = testCases.size();
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    ASSERT_THAT(rstest_run(), IsTrue());
+
+    const string mapPath = ::testing::TempDir() + "rstest_coverage_large.map";
+    (void)remove(mapPath.c_str());
+    EXPECT_THAT(rstest_coverageSave(rstest_getReport(), mapPath.c_str()), IsFalse());
+    EXPECT_THAT(ifstream(mapPath).good(), IsFalse());
+
+    // Within the limit again.
+    m_testSuite.testCases = &(m_testCases[0]);
+    m_testSuite.count     = ARRAY_SIZE(m_testCases);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    ASSERT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_coverageSave(rstest_getReport(), mapPath.c_str()), IsTrue());
+    (void)remove(mapPath.c_str());
+}
+
+#endif // defined(RSTEST_COVERAGE_MAP)
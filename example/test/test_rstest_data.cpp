@@ -0,0 +1,223 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_data.h>
+
+#include <gmock/gmock.h>
+
+#include <cfloat>
+#include <cmath>
+#include <vector>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestDataTest : public Test
+{
+public:
+    /// Constructor
+    RSTestDataTest()
+    {
+        m_testSuite.name      = "DataSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+        rstest_dataCacheClear(&RSTC_dataCache);
+    }
+
+protected:
+    TestCase_t           m_testCases[3] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                           TESTCASE_DEF(RSTC_data_range, TestCaseState_Idle),
+                                           TESTCASE_DEF(RSTC_data_range, TestCaseState_Idle)};
+    TestSuite_t          m_testSuite{}; ///< TestSuite to use for this test.
+    uint8_t              m_pool[64]{};  ///< Pool of the cache
+    TestDataCacheEntry_t m_entries[2]{};
+    TestDataCache_t      m_cache{&(m_entries[0]), ARRAY_SIZE(m_entries), 0U, &(m_pool[0]), sizeof(m_pool), 0U};
+};
+
+TEST_F(RSTestDataTest, sameSeedSameWords)
+{
+    TestRandom_t first;
+    TestRandom_t second;
+    rstest_randomSeed(&first, 42U);
+    rstest_randomSeed(&second, 42U);
+    vector<uint32_t> a(100U);
+    vector<uint32_t> b(100U);
+    rstest_randomU32(&first, a.data(), a.size());
+    rstest_randomU32(&second, b.data(), b.size());
+    EXPECT_THAT(a, ContainerEq(b));
+
+    rstest_randomSeed(&second, 43U);
+    rstest_randomU32(&second, b.data(), b.size());
+    EXPECT_THAT(a, Not(ContainerEq(b)));
+}
+
+TEST_F(RSTestDataTest, wordsIndependentOfFills)
+{
+    TestRandom_t bulk;
+    TestRandom_t pieces;
+    rstest_randomSeed(&bulk, 7U);
+    rstest_randomSeed(&pieces, 7U);
+    vector<uint32_t> whole(40U);
+    vector<uint32_t> parts(40U);
+    rstest_randomU32(&bulk, whole.data(), whole.size());
+    parts[0] = rstest_random32(&pieces);
+    rstest_randomU32(&pieces, &(parts[1]), 9U);
+    rstest_randomU32(&pieces, &(parts[10]), 30U);
+    EXPECT_THAT(parts, ContainerEq(whole));
+
+    // Bytes are the words least significant first.
+    rstest_randomSeed(&bulk, 7U);
+    vector<uint8_t> bytes(6U);
+    rstest_randomBytes(&bulk, bytes.data(), bytes.size());
+    EXPECT_THAT(bytes, ElementsAre(whole[0] & 0xFFU, (whole[0] >> 8U) & 0xFFU, (whole[0] >> 16U) & 0xFFU,
+                                   whole[0] >> 24U, whole[1] & 0xFFU, (whole[1] >> 8U) & 0xFFU));
+}
+
+TEST_F(RSTestDataTest, integersWithinRange)
+{
+    TestRandom_t rng;
+    rstest_randomSeed(&rng, 1U);
+    vector<int32_t> values(1000U);
+    rstest_randomI32(&rng, values.data(), values.size(), -2, 2);
+    EXPECT_THAT(values, Each(AllOf(Ge(-2), Le(2))));
+    EXPECT_THAT(values, Contains(-2));
+    EXPECT_THAT(values, Contains(2));
+
+    rstest_randomI32(&rng, values.data(), values.size(), INT32_MIN, INT32_MAX);
+    EXPECT_THAT(values, Contains(Lt(0)));
+    EXPECT_THAT(values, Contains(Gt(0)));
+
+    rstest_randomI32(&rng, values.data(), 1U, 5, 5);
+    EXPECT_THAT(values[0], Eq(5));
+}
+
+TEST_F(RSTestDataTest, floatsWithinRange)
+{
+    TestRandom_t rng;
+    rstest_randomSeed(&rng, 1U);
+    vector<float> floats(1000U);
+    rstest_randomFloat(&rng, floats.data(), floats.size(), -1.0F, 1.0F);
+    EXPECT_THAT(floats, Each(AllOf(Ge(-1.0F), Lt(1.0F))));
+    EXPECT_THAT(floats, Contains(Lt(-0.9F)));
+    EXPECT_THAT(floats, Contains(Gt(0.9F)));
+
+    vector<double> doubles(1000U);
+    rstest_randomDouble(&rng, doubles.data(), doubles.size(), 10.0, 20.0);
+    EXPECT_THAT(doubles, Each(AllOf(Ge(10.0), Lt(20.0))));
+}
+
+TEST_F(RSTestDataTest, floatsBelowMaxWhenRounded)
+{
+    // A range of one step - min + x * scale rounds to max for about half of the draws.
+    TestRandom_t rng;
+    rstest_randomSeed(&rng, 1U);
+    vector<float> floats(1000U);
+    rstest_randomFloat(&rng, floats.data(), floats.size(), 1.0F, nextafter(1.0F, 2.0F));
+    EXPECT_THAT(floats, Each(Eq(1.0F)));
+
+    vector<double> doubles(1000U);
+    rstest_randomDouble(&rng, doubles.data(), doubles.size(), 1.0, nextafter(1.0, 2.0));
+    EXPECT_THAT(doubles, Each(Eq(1.0)));
+}
+
+TEST_F(RSTestDataTest, floatsWithinWidestRange)
+{
+    // The span of the range overflows - the draws stay finite and within it.
+    TestRandom_t rng;
+    rstest_randomSeed(&rng, 1U);
+    vector<float> floats(1000U);
+    rstest_randomFloat(&rng, floats.data(), floats.size(), -FLT_MAX, FLT_MAX);
+    EXPECT_THAT(floats, Each(AllOf(Ge(-FLT_MAX), Lt(FLT_MAX))));
+    EXPECT_THAT(floats, Contains(Lt(-FLT_MAX / 2.0F)));
+    EXPECT_THAT(floats, Contains(Gt(FLT_MAX / 2.0F)));
+
+    vector<double> doubles(1000U);
+    rstest_randomDouble(&rng, doubles.data(), doubles.size(), -DBL_MAX, DBL_MAX);
+    EXPECT_THAT(doubles, Each(AllOf(Ge(-DBL_MAX), Lt(DBL_MAX))));
+
+    // A double range of a Float dataset is clamped to the float range.
+    const TestDataSpec_t wide{TestDataType_Float, 1U, 16U, -DBL_MAX, DBL_MAX};
+    vector<float>        data(16U);
+    ASSERT_THAT(rstest_dataFill(&wide, data.data()), IsTrue());
+    EXPECT_THAT(data, Each(AllOf(Ge(-FLT_MAX), Lt(FLT_MAX))));
+}
+
+TEST_F(RSTestDataTest, cachesDatasets)
+{
+    const TestDataSpec_t words{TestDataType_U32, 1U, 4U, 0.0, 0.0};
+    const TestDataSpec_t other{TestDataType_U32, 2U, 4U, 0.0, 0.0};
+
+    const void *first = rstest_dataGet(&m_cache, &words);
+    ASSERT_THAT(first, NotNull());
+    EXPECT_THAT(m_cache.poolUsed, Eq(16U));
+    EXPECT_THAT(rstest_dataGet(&m_cache, &words), Eq(first));
+    EXPECT_THAT(m_cache.count, Eq(1U));
+
+    // The cached dataset is the same as generated again.
+    vector<uint32_t> generated(4U);
+    ASSERT_THAT(rstest_dataFill(&words, generated.data()), IsTrue());
+    EXPECT_THAT(generated, ElementsAreArray(static_cast<const uint32_t *>(first), 4U));
+
+    const void *second = rstest_dataGet(&m_cache, &other);
+    ASSERT_THAT(second, AllOf(NotNull(), Ne(first)));
+    EXPECT_THAT(m_cache.count, Eq(2U));
+
+    rstest_dataCacheClear(&m_cache);
+    EXPECT_THAT(m_cache.count, Eq(0U));
+    EXPECT_THAT(m_cache.poolUsed, Eq(0U));
+}
+
+TEST_F(RSTestDataTest, cacheFull)
+{
+    const TestDataSpec_t large{TestDataType_Double, 1U, 9U, 0.0, 1.0};
+    const TestDataSpec_t small{TestDataType_Bytes, 1U, 3U, 0.0, 0.0};
+    const TestDataSpec_t words{TestDataType_U32, 1U, 1U, 0.0, 0.0};
+    const TestDataSpec_t bytes{TestDataType_Bytes, 2U, 3U, 0.0, 0.0};
+    const TestDataSpec_t inverted{TestDataType_I32, 1U, 4U, 1.0, 0.0};
+
+    EXPECT_THAT(rstest_dataGet(&m_cache, &large), IsNull());
+    EXPECT_THAT(rstest_dataGet(&m_cache, &inverted), IsNull());
+    ASSERT_THAT(rstest_dataGet(&m_cache, &small), NotNull());
+
+    // Aligned after the bytes.
+    const void *aligned = rstest_dataGet(&m_cache, &words);
+    ASSERT_THAT(aligned, NotNull());
+    EXPECT_THAT(reinterpret_cast<uintptr_t>(aligned) % sizeof(uint64_t), Eq(0U));
+    EXPECT_THAT(rstest_dataGet(&m_cache, &bytes), IsNull());
+    EXPECT_THAT(m_cache.count, Eq(2U));
+}
+
+TEST_F(RSTestDataTest, generatedOncePerRun)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+
+    // Both test cases share the dataset, its seed is in their results.
+    EXPECT_THAT(RSTC_dataCache.count, Eq(1U));
+    EXPECT_THAT(RSTC_dataCache.poolUsed, Eq(256U * sizeof(int32_t)));
+    const TestCaseResultList_t &results = rstest_getReport()->caseResults;
+    EXPECT_THAT(results.records[0].dataSeed, Eq(0U));
+    EXPECT_THAT(results.records[1].dataSeed, Eq(0x5EEDU));
+    EXPECT_THAT(results.records[2].dataSeed, Eq(0x5EEDU));
+}
@@ -0,0 +1,177 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <gmock/gmock.h>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestDeadlineTest : public Test
+{
+public:
+    /// Constructor
+    RSTestDeadlineTest()
+    {
+        m_testSuite.name          = "DeadlineSuite";
+        m_testSuite.testCases     = &(m_testCases[0]);
+        m_testSuite.count         = ARRAY_SIZE(m_testCases);
+        m_testSuite.startupCb     = &RSTestDeadlineTest::startupCallback;
+        m_testSuite.startupCbUser = this;
+        m_testSuite.failureCb     = &RSTestDeadlineTest::failureCallback;
+        m_testSuite.failureCbUser = this;
+        m_testSuite.clockCb       = &RSTestDeadlineTest::clockCallback;
+        m_testSuite.clockCbUser   = this;
+        s_self                    = this;
+        RSTC_callback             = &RSTestDeadlineTest::work;
+        RSTC_deadlineBudget       = 100U;
+    }
+
+    /// Destructor
+    ~RSTestDeadlineTest() override
+    {
+        RSTC_callback = nullptr;
+        s_self        = nullptr;
+    }
+
+protected:
+    /// Clock Callback - the simulated time.
+    static uint64_t clockCallback(void *user) { return reinterpret_cast<RSTestDeadlineTest *>(user)->m_now; }
+
+    /// Startup Callback - not part of the body of the test case.
+    static void startupCallback(void *user) { reinterpret_cast<RSTestDeadlineTest *>(user)->m_now += 1000U; }
+
+    /// Failure Callback function
+    static void failureCallback(const AssertRecord_t *record, void *user)
+    {
+        reinterpret_cast<RSTestDeadlineTest *>(user)->m_failureCb.Call(record);
+    }
+
+    /// Code under test - takes the next of m_work ticks.
+    static void work()
+    {
+        s_self->m_now += s_self->m_work[s_self->m_runs % 2U];
+        s_self->m_runs++;
+    }
+
+    /// Timing record of a site.
+    /// @param[in] idx index of the record
+    [[nodiscard]] static const TestTimingRecord_t &timing(size_t idx)
+    {
+        return rstest_getReport()->timing.records[idx];
+    }
+
+    static RSTestDeadlineTest *s_self; ///< Test of the work function
+
+    TestCase_t  m_testCases[2] = {TESTCASE_DEF(RSTC_completes_within, TestCaseState_Idle),
+                                  TESTCASE_DEADLINE_DEF(RSTC_callback_pass, 150U, TestCaseState_Idle)};
+    TestSuite_t m_testSuite{};          ///< TestSuite to use for this test.
+    uint64_t    m_now     = 0U;         ///< Simulated time
+    uint64_t    m_work[2] = {60U, 80U}; ///< Ticks of alternate executions of the code under test
+    uint32_t    m_runs    = 0U;         ///< Executions of the code under test
+
+    MockFunction<void(const AssertRecord_t *record)> m_failureCb; ///< Failure Callback function check
+};
+
+RSTestDeadlineTest *RSTestDeadlineTest::s_self = nullptr;
+
+TEST_F(RSTestDeadlineTest, withinDeadlines)
+{
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+
+    // The site of ASSERT_COMPLETES_WITHIN() then the deadline of the test case (startup not included).
+    ASSERT_THAT(rstest_getReport()->timing.count, Eq(2U));
+    EXPECT_THAT(timing(0U).name, StrEq("example_test_suite.c"));
+    EXPECT_THAT(timing(0U).line, Ne(0U));
+    EXPECT_THAT(timing(0U).worst, Eq(60U));
+    EXPECT_THAT(timing(0U).deadline, Eq(100U));
+    EXPECT_THAT(timing(0U).margin, Eq(40));
+    EXPECT_THAT(timing(1U).name, StrEq("RSTC_callback_pass"));
+    EXPECT_THAT(timing(1U).line, Eq(0U));
+    EXPECT_THAT(timing(1U).worst, Eq(80U));
+    EXPECT_THAT(timing(1U).margin, Eq(70));
+}
+
+TEST_F(RSTestDeadlineTest, worstOverRuns)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    m_work[0] = 90U;
+    EXPECT_THAT(rstest_run(), IsTrue());
+    m_work[0] = 10U;
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(rstest_getReport()->timing.count, Eq(2U));
+    EXPECT_THAT(timing(0U).runs, Eq(3U));
+    EXPECT_THAT(timing(0U).worst, Eq(90U));
+    EXPECT_THAT(timing(0U).margin, Eq(10));
+    EXPECT_THAT(timing(1U).runs, Eq(3U));
+    EXPECT_THAT(timing(1U).exceeded, Eq(0U));
+}
+
+TEST_F(RSTestDeadlineTest, exceededSiteFails)
+{
+    RSTC_deadlineBudget = 50U;
+    EXPECT_CALL(m_failureCb,
+                Call(AllOf(Field(&AssertRecord_t::kind, Eq(AssertKind_Timing)),
+                           Field(&AssertRecord_t::file, StrEq("example_test_suite.c")))))
+        .Times(1);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(rstest_getReport()->caseResults.records[0].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(rstest_getReport()->caseResults.records[1].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(timing(0U).exceeded, Eq(1U));
+    EXPECT_THAT(timing(0U).margin, Eq(-10));
+    ASSERT_THAT(rstest_getReport()->failAsserts.count, Eq(1U));
+    EXPECT_THAT(rstest_getReport()->failAsserts.records[0].kind, Eq(AssertKind_Timing));
+}
+
+TEST_F(RSTestDeadlineTest, exceededTestCaseDeadlineFails)
+{
+    m_testCases[1].deadline = 70U;
+    EXPECT_CALL(m_failureCb, Call(AllOf(Field(&AssertRecord_t::kind, Eq(AssertKind_Timing)),
+                                        Field(&AssertRecord_t::file, StrEq("RSTC_callback_pass")),
+                                        Field(&AssertRecord_t::line, Eq(0U)))))
+        .Times(1);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(rstest_getReport()->caseResults.records[0].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(rstest_getReport()->caseResults.records[1].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(timing(1U).worst, Eq(80U));
+    EXPECT_THAT(timing(1U).margin, Eq(-10));
+}
+
+TEST_F(RSTestDeadlineTest, notTimedWithoutClock)
+{
+    m_testSuite.clockCb = nullptr;
+    RSTC_deadlineBudget = 0U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(rstest_getReport()->timing.count, Eq(0U));
+}
@@ -0,0 +1,107 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_fuzz.h>
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <cstring>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+namespace
+{
+TestCase_t k_fuzzCases[] = {
+    TESTCASE_PARAM_DEF(RSTC_param_sum_commutes, RSTC_sumVectors, ARRAY_SIZE(RSTC_sumVectors), TestCaseState_Idle),
+    TESTCASE_PARAM_DEF(RSTC_param_sum, RSTC_sumVectors, ARRAY_SIZE(RSTC_sumVectors), TestCaseState_Idle),
+    TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle)};
+
+/// Make a test suite without callbacks.
+TestSuite_t makeTestSuite(const char *name, TestCase_t *testCases, size_t count)
+{
+    TestSuite_t testSuite{};
+    testSuite.name      = name;
+    testSuite.testCases = testCases;
+    testSuite.count     = count;
+    return testSuite;
+}
+
+const TestSuite_t k_fuzzSuite = makeTestSuite("FuzzSuite", k_fuzzCases, ARRAY_SIZE(k_fuzzCases));
+} // namespace
+
+/// Test Suite for the libFuzzer entry points.
+const TestSuite_t *rstest_fuzzTestSuite(void) { return &k_fuzzSuite; }
+
+//-----------------------------------------------------------------------------
+class RSTestFuzzTest : public Test
+{
+protected:
+    /// Build an input selecting a test case with a parameter.
+    /// @param[in] select selector byte
+    /// @param[in] vector parameter
+    static std::array<uint8_t, 1U + sizeof(RSTC_SumVector_t)> input(uint8_t select, const RSTC_SumVector_t &vector)
+    {
+        std::array<uint8_t, 1U + sizeof(RSTC_SumVector_t)> data{select};
+        std::memcpy(&data[1], &vector, sizeof(vector));
+        return data;
+    }
+};
+
+TEST_F(RSTestFuzzTest, passingInputs)
+{
+    EXPECT_THAT(LLVMFuzzerInitialize(nullptr, nullptr), Eq(0));
+
+    // Commutes holds for every input, including short and empty inputs.
+    const auto data = input(0U, RSTC_SumVector_t{0xFFFFFFFFU, 2U, 0U});
+    EXPECT_THAT(LLVMFuzzerTestOneInput(data.data(), data.size()), Eq(0));
+    EXPECT_THAT(LLVMFuzzerTestOneInput(data.data(), 3U), Eq(0));
+    EXPECT_THAT(LLVMFuzzerTestOneInput(nullptr, 0U), Eq(0));
+
+    // Valid sum for the sum test case.
+    const auto sum = input(1U, RSTC_SumVector_t{3U, 4U, 7U});
+    EXPECT_THAT(LLVMFuzzerTestOneInput(sum.data(), sum.size()), Eq(0));
+}
+
+TEST_F(RSTestFuzzTest, failureCrashes)
+{
+    const auto data = input(1U, RSTC_SumVector_t{3U, 4U, 8U});
+    EXPECT_DEATH(
+        {
+            (void)LLVMFuzzerInitialize(nullptr, nullptr);
+            (void)LLVMFuzzerTestOneInput(data.data(), data.size());
+        },
+        "");
+}
+
+TEST_F(RSTestFuzzTest, nothingToFuzz)
+{
+    // Benchmark and stress test cases are parameterized by their definition - not fuzzed.
+    TestCase_t  testCases[] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                               TESTCASE_BENCH_DEF(RSTC_popcount, RSTC_bench_popcount, TestCaseState_Idle),
+                               TESTCASE_STRESS_DEF(RSTC_counts, RSTC_stress_counts, TestCaseState_Idle)};
+    TestSuite_t testSuite   = makeTestSuite("NoParams", testCases, ARRAY_SIZE(testCases));
+    EXPECT_THAT(rstest_fuzzInit(&testSuite), IsFalse());
+    EXPECT_THAT(rstest_fuzzInit(nullptr), IsFalse());
+}
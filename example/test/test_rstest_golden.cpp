@@ -0,0 +1,167 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_golden.h>
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestGoldenTest : public Test
+{
+public:
+    /// Constructor - writes the golden file, spanning several compare blocks.
+    RSTestGoldenTest() : m_golden(10000U)
+    {
+        for (size_t idx = 0U; idx < m_golden.size(); idx++)
+        {
+            m_golden[idx] = static_cast<uint8_t>(idx * 7U);
+        }
+        ofstream(m_path, ios::binary).write(reinterpret_cast<const char *>(m_golden.data()),
+                                           static_cast<streamsize>(m_golden.size()));
+
+        m_testSuite.name      = "GoldenSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+    }
+
+    /// Destructor - remove the golden and actual output files.
+    ~RSTestGoldenTest() override
+    {
+        rstest_goldenWriteActual(false);
+        RSTC_goldenPath   = nullptr;
+        RSTC_goldenOutput = nullptr;
+        (void)remove(m_path.c_str());
+        (void)remove((m_path + ".actual").c_str());
+    }
+
+protected:
+    /// Golden data with one byte changed.
+    /// @param[in] offset offset of the changed byte
+    [[nodiscard]] vector<uint8_t> changed(size_t offset) const
+    {
+        vector<uint8_t> actual = m_golden;
+        actual[offset]++;
+        return actual;
+    }
+
+    /// Compare in chunks.
+    /// @param[in] actual output to compare
+    /// @param[in] chunkSize size of each chunk
+    /// @returns result of each chunk then the close
+    [[nodiscard]] vector<bool> chunks(const vector<uint8_t> &actual, size_t chunkSize) const
+    {
+        vector<bool> results;
+        TestGolden_t golden;
+        results.push_back(rstest_goldenOpen(&golden, m_path.c_str()));
+        for (size_t offset = 0U; offset < actual.size(); offset += chunkSize)
+        {
+            results.push_back(rstest_goldenChunk(&golden, &actual[offset], min(chunkSize, actual.size() - offset)));
+        }
+        results.push_back(rstest_goldenClose(&golden));
+        return results;
+    }
+
+    const string    m_path = ::testing::TempDir() + "rstest_golden_test.bin";
+    vector<uint8_t> m_golden;                                                                 ///< Golden file content
+    TestCase_t      m_testCases[2] = {TESTCASE_DEF(RSTC_golden_match, TestCaseState_Idle),
+                                      TESTCASE_DEF(RSTC_golden_chunks, TestCaseState_Idle)};
+    TestSuite_t     m_testSuite{}; ///< TestSuite to use for this test.
+};
+
+TEST_F(RSTestGoldenTest, matches)
+{
+    EXPECT_THAT(rstest_goldenMatch(m_golden.data(), m_golden.size(), m_path.c_str()), IsTrue());
+    EXPECT_THAT(chunks(m_golden, 3000U), Each(IsTrue()));
+    EXPECT_THAT(chunks(m_golden, 1U), Each(IsTrue()));
+}
+
+TEST_F(RSTestGoldenTest, mismatchOffset)
+{
+    const vector<uint8_t> actual = changed(5000U);
+    EXPECT_THAT(rstest_goldenMatch(actual.data(), actual.size(), m_path.c_str()), IsFalse());
+    EXPECT_THAT(rstest_goldenMismatchOffset(), Eq(5000U));
+
+    EXPECT_THAT(rstest_goldenMatch(m_golden.data(), m_golden.size() - 1U, m_path.c_str()), IsFalse());
+    EXPECT_THAT(rstest_goldenMismatchOffset(), Eq(m_golden.size() - 1U));
+
+    vector<uint8_t> longer = m_golden;
+    longer.push_back(0U);
+    EXPECT_THAT(rstest_goldenMatch(longer.data(), longer.size(), m_path.c_str()), IsFalse());
+    EXPECT_THAT(rstest_goldenMismatchOffset(), Eq(m_golden.size()));
+
+    EXPECT_THAT(rstest_goldenMatch(m_golden.data(), m_golden.size(), "no/such/golden.bin"), IsFalse());
+}
+
+TEST_F(RSTestGoldenTest, chunkMismatchReportedOnce)
+{
+    // Open, 4 chunks, close - only the chunk with the mismatch fails.
+    EXPECT_THAT(chunks(changed(4000U), 3000U), ElementsAre(true, true, false, true, true, true));
+    EXPECT_THAT(rstest_goldenMismatchOffset(), Eq(4000U));
+
+    vector<uint8_t> shorter(m_golden.begin(), m_golden.end() - 10);
+    EXPECT_THAT(chunks(shorter, 3000U), ElementsAre(true, true, true, true, true, false));
+    EXPECT_THAT(rstest_goldenMismatchOffset(), Eq(shorter.size()));
+}
+
+TEST_F(RSTestGoldenTest, writesActual)
+{
+    rstest_goldenWriteActual(true);
+    EXPECT_THAT(rstest_goldenMatch(m_golden.data(), m_golden.size(), m_path.c_str()), IsTrue());
+    EXPECT_THAT(ifstream(m_path + ".actual").good(), IsFalse());
+
+    const vector<uint8_t> actual = changed(6500U);
+    (void)chunks(actual, 3000U);
+    stringstream content;
+    content << ifstream(m_path + ".actual", ios::binary).rdbuf();
+    EXPECT_THAT(content.str(), Eq(string(actual.begin(), actual.end())));
+}
+
+TEST_F(RSTestGoldenTest, singleAssertionOnMismatch)
+{
+    const vector<uint8_t> actual = changed(100U);
+    RSTC_goldenPath              = m_path.c_str();
+    RSTC_goldenOutput            = actual.data();
+    RSTC_goldenOutputLen         = actual.size();
+
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+    const TestReport_t *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    // A single assertion per test case - the chunks after the mismatch are not compared.
+    EXPECT_THAT(report->failCount, Eq(2U));
+    EXPECT_THAT(report->failAsserts.count, Eq(2U));
+
+    RSTC_goldenOutput = m_golden.data();
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(report->caseResults.records[0].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Pass));
+}
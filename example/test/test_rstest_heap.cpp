@@ -0,0 +1,189 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <gmock/gmock.h>
+
+using namespace ::std;
+using namespace ::testing;
+
+#if defined(RSTEST_HEAP_TRACKING)
+
+//-----------------------------------------------------------------------------
+class RSTestHeapTest : public Test
+{
+public:
+    /// Constructor
+    RSTestHeapTest()
+        : m_limits(TestHeapLimits_t RSTEST_HEAP_LIMITS_DEFAULT)
+        , m_testSuite(TestSuite_t{.name                = "HeapSuite",
+                                  .testCases           = nullptr,
+                                  .count               = 0U,
+                                  .startupCb           = nullptr,
+                                  .startupCbUser       = nullptr,
+                                  .teardownCb          = nullptr,
+                                  .teardownCbUser      = nullptr,
+                                  .failureCb           = &RSTestHeapTest::failureCallback,
+                                  .failureCbUser       = this,
+                                  .heapLimits          = &m_limits,
+                                  .paramBatch          = 0U,
+                                  .asyncPollCb         = nullptr,
+                                  .asyncPollCbUser     = nullptr,
+                                  .clockCb             = nullptr,
+                                  .clockCbUser         = nullptr,
+                                  .baseline            = nullptr,
+                                  .suiteStartupCb      = nullptr,
+                                  .suiteStartupCbUser  = nullptr,
+                                  .suiteTeardownCb     = nullptr,
+                                  .suiteTeardownCbUser = nullptr,
+                                  .snapshotRegions     = nullptr,
+                                  .snapshotCount       = 0U,
+                                  .perfLimits          = nullptr,
+                                  .stack               = nullptr})
+    {
+    }
+
+    /// Destructor - release any leaked allocation.
+    ~RSTestHeapTest() override { RSTC_heap_leakRelease(); }
+
+protected:
+    /// Failure Callback function to send to rstest
+    static void failureCallback(const AssertRecord_t *record, void *user)
+    {
+        auto that = reinterpret_cast<RSTestHeapTest *>(user);
+        that->m_failureCb.Call(record);
+    }
+
+    MockFunction<void(const AssertRecord_t *record)> m_failureCb; ///< Failure Callback function check
+    TestHeapLimits_t                                 m_limits;    ///< Heap limits for the suite
+    TestSuite_t                                      m_testSuite; ///< TestSuite to use for this test.
+};
+
+TEST_F(RSTestHeapTest, balancedAllocations)
+{
+    TestCase_t testCases[] = {TESTCASE_DEF(RSTC_heap_balanced, TestCaseState_Idle)};
+    m_testSuite.testCases  = testCases;
+    m_testSuite.count      = ARRAY_SIZE(testCases);
+
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+
+    const auto *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    ASSERT_THAT(report->caseResults.count, Eq(1U));
+    const auto &heap = report->caseResults.records[0].heap;
+    EXPECT_THAT(heap.allocCount, Eq(2U));
+    EXPECT_THAT(heap.freeCount, Eq(2U));
+    EXPECT_THAT(heap.allocBytes, Eq(48U));
+    EXPECT_THAT(heap.peakBytes, Eq(48U));
+    EXPECT_THAT(heap.leakedBytes, Eq(0U));
+}
+
+TEST_F(RSTestHeapTest, leakFailsTestCase)
+{
+    TestCase_t testCases[] = {TESTCASE_DEF(RSTC_heap_leak, TestCaseState_Idle)};
+    m_testSuite.testCases  = testCases;
+    m_testSuite.count      = ARRAY_SIZE(testCases);
+
+    EXPECT_CALL(m_failureCb, Call(NotNull())).Times(1);
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+
+    const auto *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->failCount, Eq(1U));
+    EXPECT_THAT(report->caseResults.records[0].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(report->caseResults.records[0].heap.leakedBytes, Eq(64U));
+}
+
+TEST_F(RSTestHeapTest, leakAllowedWithoutLimits)
+{
+    TestCase_t testCases[] = {TESTCASE_DEF(RSTC_heap_leak, TestCaseState_Idle)};
+    m_testSuite.testCases  = testCases;
+    m_testSuite.count      = ARRAY_SIZE(testCases);
+    m_testSuite.heapLimits = nullptr;
+
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(rstest_getReport()->caseResults.records[0].heap.leakedBytes, Eq(64U));
+}
+
+TEST_F(RSTestHeapTest, peakLimitFailsTestCase)
+{
+    TestCase_t testCases[] = {TESTCASE_DEF(RSTC_heap_balanced, TestCaseState_Idle),
+                              TESTCASE_DEF(RSTC_heap_realloc, TestCaseState_Idle)};
+    m_testSuite.testCases  = testCases;
+    m_testSuite.count      = ARRAY_SIZE(testCases);
+    m_limits.maxPeakBytes  = 64U;
+
+    EXPECT_CALL(m_failureCb, Call(NotNull())).Times(1);
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    const auto *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->passCount, Eq(1U));
+    EXPECT_THAT(report->failCount, Eq(1U));
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(report->caseResults.records[1].heap.peakBytes, Eq(128U));
+    EXPECT_THAT(report->caseResults.records[1].heap.leakedBytes, Eq(0U));
+}
+
+TEST_F(RSTestHeapTest, snapshotStartupNotMeasured)
+{
+    // Allocated by the startup callback, released by the teardown callback - once in snapshot mode.
+    static void         *kept        = nullptr;
+    uint32_t             value       = 0U;
+    uint32_t             copy        = 0U;
+    TestSnapshotRegion_t region      = {.addr = &value, .copy = &copy, .size = sizeof(value)};
+    TestCase_t           testCases[] = {TESTCASE_DEF(RSTC_heap_balanced, TestCaseState_Idle),
+                                        TESTCASE_DEF(RSTC_heap_balanced, TestCaseState_Idle)};
+    m_testSuite.testCases  = testCases;
+    m_testSuite.count      = ARRAY_SIZE(testCases);
+    m_testSuite.startupCb  = [](void *) { kept = rstest_malloc(32U); };
+    m_testSuite.teardownCb = [](void *) {
+        rstest_free(kept);
+        kept = nullptr;
+    };
+    m_testSuite.snapshotRegions = &region;
+    m_testSuite.snapshotCount   = 1U;
+
+    EXPECT_CALL(m_failureCb, Call(_)).Times(0);
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+
+    const auto *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    for (size_t idx = 0U; idx < ARRAY_SIZE(testCases); idx++)
+    {
+        EXPECT_THAT(report->caseResults.records[idx].heap.allocCount, Eq(2U));
+        EXPECT_THAT(report->caseResults.records[idx].heap.leakedBytes, Eq(0U));
+    }
+    EXPECT_THAT(kept, IsNull());
+}
+
+#endif // defined(RSTEST_HEAP_TRACKING)
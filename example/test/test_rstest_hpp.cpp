@@ -0,0 +1,112 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest.hpp>
+
+#include <gmock/gmock.h>
+
+#include <array>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+namespace
+{
+constexpr std::array k_cases{
+    rstest::testCase("RSTC_pass_end", &RSTC_pass_end),
+    rstest::testCase("RSTC_fail_end", &RSTC_fail_end, TestCaseState_Disabled),
+    rstest::paramTestCase("RSTC_param_sum_commutes", &RSTC_param_sum_commutes, RSTC_sumVectors),
+    rstest::asyncTestCase("RSTC_async_wait2", &RSTC_async_wait2, TestCaseState_Disabled),
+};
+
+using HppSuite = rstest::Suite<"HppSuite", k_cases>;
+
+// Malformed suites - would fail the static_assert of rstest::Suite.
+constexpr std::array k_badState{rstest::testCase("RSTC_pass_end", &RSTC_pass_end, TestCaseState_Pass)};
+constexpr std::array k_noFunction{rstest::testCase("RSTC_pass_end", nullptr)};
+constexpr std::array k_sameName{rstest::testCase("RSTC_pass_end", &RSTC_pass_end),
+                                rstest::testCase("RSTC_pass_end", &RSTC_fail_end)};
+
+constexpr const char *k_needsPass[]  = {"RSTC_pass_end", nullptr};
+constexpr const char *k_needsFail[]  = {"RSTC_fail_end", nullptr};
+constexpr const char *k_needsAsync[] = {"RSTC_async_wait2", nullptr};
+constexpr std::array  k_chain{rstest::dependsOn(rstest::testCase("RSTC_fail_end", &RSTC_fail_end), k_needsPass),
+                              rstest::testCase("RSTC_pass_end", &RSTC_pass_end),
+                              rstest::dependsOn(rstest::testCase("RSTC_fail_assert_pass_end", &RSTC_fail_assert_pass_end),
+                                                k_needsFail)};
+constexpr std::array  k_cycle{rstest::dependsOn(rstest::testCase("RSTC_fail_end", &RSTC_fail_end), k_needsPass),
+                              rstest::dependsOn(rstest::testCase("RSTC_pass_end", &RSTC_pass_end), k_needsFail)};
+constexpr std::array  k_asyncDepend{
+    rstest::asyncTestCase("RSTC_async_wait2", &RSTC_async_wait2),
+    rstest::dependsOn(rstest::testCase("RSTC_pass_end", &RSTC_pass_end), k_needsAsync)};
+
+static_assert(rstest::validDepends(k_chain));
+static_assert(rstest::dependsLevels(k_chain) == std::array<uint32_t, 3>{1U, 0U, 2U});
+static_assert(!rstest::validDepends(k_cycle));
+static_assert(!rstest::validDepends(k_asyncDepend));
+static_assert(!rstest::validTestCases(k_badState));
+static_assert(!rstest::validTestCases(k_noFunction));
+static_assert(rstest::uniqueNames(k_noFunction));
+static_assert(!rstest::uniqueNames(k_sameName));
+static_assert(rstest::withDeadline(rstest::testCase("RSTC_pass_end", &RSTC_pass_end), 500U).deadline == 500U);
+
+// Compile time test suite data.
+static_assert(HppSuite::count == 4U);
+static_assert(HppSuite::testSuite.count == HppSuite::count);
+static_assert(HppSuite::testSuite.testCases == HppSuite::testCases.data());
+static_assert(HppSuite::hash == rstest::nameHash("HppSuite"));
+static_assert(HppSuite::nameHashes[2] == rstest::nameHash("RSTC_param_sum_commutes"));
+static_assert(HppSuite::indexOf("RSTC_fail_end") == 1U);
+static_assert(HppSuite::indexOf("RSTC_unknown") == HppSuite::count);
+static_assert(HppSuite::levels[0] == 0U);
+static_assert(k_cases[2].paramCount == RSTC_SUM_VECTOR_COUNT);
+static_assert(k_cases[2].paramSize == sizeof(RSTC_SumVector_t));
+} // namespace
+
+//-----------------------------------------------------------------------------
+TEST(RSTestHppTest, runSuite)
+{
+    EXPECT_THAT(rstest::init<HppSuite>(), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+
+    const auto *report = rstest_getReport();
+    ASSERT_THAT(report, NotNull());
+    EXPECT_THAT(report->name, StrEq("HppSuite"));
+    EXPECT_THAT(report->testCount, Eq(HppSuite::count));
+    EXPECT_THAT(report->disabledCount, Eq(2));
+    EXPECT_THAT(report->passCount, Eq(2));
+    EXPECT_THAT(report->caseResults.records[HppSuite::indexOf("RSTC_param_sum_commutes")].paramCount,
+                Eq(RSTC_SUM_VECTOR_COUNT));
+}
+
+TEST(RSTestHppTest, sameChecksAsInit)
+{
+    // The runtime checks agree with the compile time checks.
+    std::array<TestCase_t, 1> badState = k_badState;
+    TestSuite_t               suite{};
+    suite.name      = "Bad";
+    suite.testCases = badState.data();
+    suite.count     = badState.size();
+    EXPECT_THAT(rstest_init(&suite), IsFalse());
+}
@@ -0,0 +1,172 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_log.h>
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestLogTest : public Test
+{
+public:
+    /// Constructor
+    RSTestLogTest()
+    {
+        m_testSuite.name      = "LogSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+    }
+
+    /// Destructor - stop logging.
+    ~RSTestLogTest() override { (void)rstest_setLog(nullptr); }
+
+protected:
+    /// Formatted failure entry of the log.
+    /// @param[in] idx index of the failure entry
+    [[nodiscard]] string message(uint32_t idx) const
+    {
+        array<char, 128> buf{};
+        (void)rstest_logFormat(&(m_failEntries[idx]), buf.data(), buf.size());
+        return {buf.data()};
+    }
+
+    TestCase_t     m_testCases[3] = {TESTCASE_DEF(RSTC_log_pass, TestCaseState_Idle),
+                                     TESTCASE_DEF(RSTC_log_fail, TestCaseState_Idle),
+                                     TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle)};
+    TestSuite_t    m_testSuite{};       ///< TestSuite to use for this test.
+    TestLogEntry_t m_entries[4]{};      ///< Ring buffer of the executing test case
+    TestLogEntry_t m_failEntries[8]{};  ///< Entries of the failed test cases
+    TestLog_t      m_log{&(m_entries[0]), ARRAY_SIZE(m_entries), 0U, &(m_failEntries[0]), ARRAY_SIZE(m_failEntries), 0U};
+};
+
+TEST_F(RSTestLogTest, keepsFailedCaseOnly)
+{
+    ASSERT_THAT(rstest_setLog(&m_log), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+
+    ASSERT_THAT(rstest_logFailCount(&m_log), Eq(3U));
+    for (uint32_t idx = 0U; idx < 3U; idx++)
+    {
+        EXPECT_THAT(m_failEntries[idx].caseIndex, Eq(1U));
+    }
+    EXPECT_THAT(message(0U), StrEq("start"));
+    EXPECT_THAT(message(1U), StrEq("value -3 of step at 0x002a"));
+    EXPECT_THAT(message(2U), StrEq("after x%"));
+}
+
+TEST_F(RSTestLogTest, keepsLatestOfFullRing)
+{
+    m_log.capacity = 2U;
+    ASSERT_THAT(rstest_setLog(&m_log), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    ASSERT_THAT(rstest_logFailCount(&m_log), Eq(2U));
+    EXPECT_THAT(message(0U), StrEq("value -3 of step at 0x002a"));
+    EXPECT_THAT(message(1U), StrEq("after x%"));
+}
+
+TEST_F(RSTestLogTest, countsDroppedFailEntries)
+{
+    m_log.failCapacity = 1U;
+    ASSERT_THAT(rstest_setLog(&m_log), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(rstest_logFailCount(&m_log), Eq(1U));
+    EXPECT_THAT(m_log.failCount, Eq(3U));
+    EXPECT_THAT(message(0U), StrEq("start"));
+}
+
+TEST_F(RSTestLogTest, keepsNeverEndedCase)
+{
+    m_testCases[1] = TESTCASE_DEF(RSTC_log_no_end, TestCaseState_Idle);
+    ASSERT_THAT(rstest_setLog(&m_log), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    ASSERT_THAT(rstest_logFailCount(&m_log), Eq(1U));
+    EXPECT_THAT(m_failEntries[0].caseIndex, Eq(1U));
+    EXPECT_THAT(message(0U), StrEq("before return 7"));
+}
+
+TEST_F(RSTestLogTest, rejectsCapacityNotPowerOf2)
+{
+    m_log.capacity = 3U;
+    EXPECT_THAT(rstest_setLog(&m_log), IsFalse());
+}
+
+TEST_F(RSTestLogTest, ignoresLogOutsideTestCase)
+{
+    ASSERT_THAT(rstest_setLog(&m_log), IsTrue());
+    RSTEST_LOG("outside %d", 1);
+    EXPECT_THAT(m_log.head, Eq(0U));
+}
+
+TEST_F(RSTestLogTest, formatsConversions)
+{
+    TestLogEntry_t entry{"%5s|%-3d|%lu|%zx|%X|%p|%f|%", {}, 0U};
+    entry.args[0] = reinterpret_cast<uintptr_t>("ab");
+    entry.args[1] = static_cast<uintptr_t>(-1);
+    entry.args[2] = 123456U;
+    entry.args[3] = 0xbeefU;
+
+    array<char, 64> buf{};
+    const size_t    len = rstest_logFormat(&entry, buf.data(), buf.size());
+    EXPECT_THAT(string(buf.data()), StrEq("   ab|-1 |123456|beef|0|(nil)|?|%"));
+    EXPECT_THAT(len, Eq(strlen(buf.data())));
+
+    // Truncated but terminated, the length is the full length.
+    array<char, 6> small{};
+    EXPECT_THAT(rstest_logFormat(&entry, small.data(), small.size()), Eq(len));
+    EXPECT_THAT(string(small.data()), StrEq("   ab"));
+}
+
+TEST_F(RSTestLogTest, exportsFailEntries)
+{
+    ASSERT_THAT(rstest_setLog(&m_log), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    const string path = TempDir() + "rstest_log.txt";
+    ASSERT_THAT(rstest_logExport(&m_log, &m_testSuite, path.c_str()), IsTrue());
+    ifstream     file(path);
+    stringstream content;
+    content << file.rdbuf();
+    EXPECT_THAT(content.str(), StrEq("RSTC_log_fail: start\n"
+                                     "RSTC_log_fail: value -3 of step at 0x002a\n"
+                                     "RSTC_log_fail: after x%\n"));
+    (void)remove(path.c_str());
+}
@@ -0,0 +1,101 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <gmock/gmock.h>
+
+using namespace ::std;
+using namespace ::testing;
+
+#if defined(RSTEST_PERF_COUNTERS)
+
+//-----------------------------------------------------------------------------
+class RSTestPerfTest : public Test
+{
+public:
+    /// Constructor
+    RSTestPerfTest()
+    {
+        m_testSuite.name       = "PerfSuite";
+        m_testSuite.testCases  = &(m_testCases[0]);
+        m_testSuite.count      = ARRAY_SIZE(m_testCases);
+        m_testSuite.perfLimits = &m_limits;
+    }
+
+protected:
+    /// Are all the counters counted?
+    /// @param[in] stats performance counters of a test case
+    /// @param[in] counters TestPerfCounter_t values
+    [[nodiscard]] static bool counted(const TestPerfStats_t &stats, initializer_list<TestPerfCounter_t> counters)
+    {
+        return all_of(counters.begin(), counters.end(),
+                      [&stats](TestPerfCounter_t counter) { return (stats.valid & (1U << counter)) != 0U; });
+    }
+
+    /// Run the test suite
+    /// @returns performance counters of the test case
+    TestPerfStats_t run()
+    {
+        m_testCases[0].state = TestCaseState_Idle;
+        EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+        EXPECT_THAT(rstest_run(), IsTrue());
+        const TestReport_t *report = rstest_getReport();
+        EXPECT_THAT(report, NotNull());
+        return (report != nullptr) ? report->caseResults.records[0].perf : TestPerfStats_t{};
+    }
+
+    TestCase_t       m_testCases[1] = {
+        TESTCASE_PARAM_DEF(RSTC_param_sum_commutes, RSTC_sumVectors, ARRAY_SIZE(RSTC_sumVectors), TestCaseState_Idle)};
+    TestPerfLimits_t m_limits{};    ///< Performance limits for the suite (none)
+    TestSuite_t      m_testSuite{}; ///< TestSuite to use for this test.
+};
+
+TEST_F(RSTestPerfTest, countsBody)
+{
+    // Counters may be unavailable (container, virtual machine) - then nothing is counted.
+    const TestPerfStats_t stats = run();
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(stats.valid & ~((1U << RSTEST_PERF_COUNTER_COUNT) - 1U), Eq(0U));
+    if (counted(stats, {TestPerfCounter_Cycles, TestPerfCounter_Instructions}))
+    {
+        EXPECT_THAT(stats.counts[TestPerfCounter_Cycles], Gt(0U));
+        EXPECT_THAT(stats.counts[TestPerfCounter_Instructions], Gt(0U));
+    }
+}
+
+TEST_F(RSTestPerfTest, minIpcLimit)
+{
+    m_limits.minIpcPermille = UINT32_MAX;
+    const TestPerfStats_t stats = run();
+    const bool            judged = counted(stats, {TestPerfCounter_Cycles, TestPerfCounter_Instructions}) &&
+                                   (stats.counts[TestPerfCounter_Cycles] != 0U);
+    EXPECT_THAT(rstest_testSuitePassed(), Ne(judged));
+}
+
+TEST_F(RSTestPerfTest, maxCyclesLimit)
+{
+    m_limits.maxCycles          = 1U;
+    const TestPerfStats_t stats = run();
+    const bool            judged = counted(stats, {TestPerfCounter_Cycles}) && (stats.counts[TestPerfCounter_Cycles] > 1U);
+    EXPECT_THAT(rstest_testSuitePassed(), Ne(judged));
+}
+
+#endif // defined(RSTEST_PERF_COUNTERS)
@@ -0,0 +1,118 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_plugin.h>
+
+#include <gmock/gmock.h>
+
+using namespace ::std;
+using namespace ::testing;
+
+namespace
+{
+TestSuite_t              k_pluginSuite{};                     ///< Test suite exported from C++
+const TestSuite_t *const k_pluginSuites[] = {&k_pluginSuite}; ///< Test suites exported from C++
+} // namespace
+
+// A C++ plugin exports the symbol with C linkage as a C plugin does.
+RSTEST_PLUGIN_EXPORT(k_pluginSuites);
+
+//-----------------------------------------------------------------------------
+class RSTestPluginTest : public Test
+{
+public:
+    /// Constructor
+    RSTestPluginTest()
+    {
+        m_testSuite.name      = "PluginSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+    }
+
+protected:
+    /// Plugin Suite Callback - counts the calls.
+    static void suiteCallback(const char * /*path*/, const TestSuite_t * /*testSuite*/, const TestReport_t * /*report*/,
+                              void *user)
+    {
+        (*reinterpret_cast<uint32_t *>(user))++;
+    }
+
+    TestCase_t         m_testCases[3] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                         TESTCASE_DEF(RSTC_pass_assert_pass_end, TestCaseState_Idle),
+                                         TESTCASE_DEF(RSTC_fail_end, TestCaseState_Disabled)};
+    TestSuite_t        m_testSuite{}; ///< TestSuite to use for this test.
+    TestPluginReport_t m_merged{};    ///< Merged report
+};
+
+TEST_F(RSTestPluginTest, mergesReports)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    ASSERT_THAT(rstest_run(), IsTrue());
+    rstest_pluginMerge(&m_merged, rstest_getReport(), rstest_testSuitePassed());
+    rstest_pluginMerge(&m_merged, rstest_getReport(), rstest_testSuitePassed());
+
+    EXPECT_THAT(m_merged.suiteCount, Eq(2U));
+    EXPECT_THAT(m_merged.suiteFailCount, Eq(0U));
+    EXPECT_THAT(m_merged.testCount, Eq(6U));
+    EXPECT_THAT(m_merged.executedCount, Eq(4U));
+    EXPECT_THAT(m_merged.passCount, Eq(4U));
+    EXPECT_THAT(m_merged.disabledCount, Eq(2U));
+    EXPECT_THAT(m_merged.passAssertCount, Eq(2U * rstest_getReport()->passAssertCount));
+    EXPECT_THAT(rstest_pluginPassed(&m_merged), IsTrue());
+}
+
+TEST_F(RSTestPluginTest, failedSuiteFailsMerged)
+{
+    m_testCases[2].state = TestCaseState_Idle;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    ASSERT_THAT(rstest_run(), IsTrue());
+    rstest_pluginMerge(&m_merged, rstest_getReport(), rstest_testSuitePassed());
+    rstest_pluginMerge(&m_merged, NULL, false);
+
+    EXPECT_THAT(m_merged.suiteCount, Eq(2U));
+    EXPECT_THAT(m_merged.suiteFailCount, Eq(2U));
+    EXPECT_THAT(m_merged.failCount, Eq(1U));
+    EXPECT_THAT(rstest_pluginPassed(&m_merged), IsFalse());
+}
+
+TEST_F(RSTestPluginTest, noSuiteNotPassed) { EXPECT_THAT(rstest_pluginPassed(&m_merged), IsFalse()); }
+
+TEST_F(RSTestPluginTest, missingPluginFailsLoad)
+{
+    uint32_t calls = 0U;
+    EXPECT_THAT(rstest_pluginRun("/nonexistent/librstest_missing_plugin.so", &m_merged,
+                                 &RSTestPluginTest::suiteCallback, &calls),
+                IsFalse());
+
+    EXPECT_THAT(m_merged.loadFailCount, Eq(1U));
+    EXPECT_THAT(m_merged.pluginCount, Eq(0U));
+    EXPECT_THAT(calls, Eq(0U));
+    EXPECT_THAT(rstest_pluginPassed(&m_merged), IsFalse());
+}
+
+TEST_F(RSTestPluginTest, exportsFromCpp)
+{
+    EXPECT_THAT(rstest_plugin.version, Eq(RSTEST_PLUGIN_VERSION));
+    EXPECT_THAT(rstest_plugin.count, Eq(1U));
+    EXPECT_THAT(rstest_plugin.suites[0], Eq(&k_pluginSuite));
+}
@@ -0,0 +1,140 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <cstdint>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+TEST(RSTestStackPaintTest, measuresDeepestWrittenWord)
+{
+    alignas(uint32_t) array<uint8_t, 64> region{};
+    rstest_stackPaint(region.data(), region.size());
+    EXPECT_THAT(rstest_stackUsed(region.data(), region.size()), Eq(0U));
+
+    region[63] = 0U;
+    EXPECT_THAT(rstest_stackUsed(region.data(), region.size()), Eq(4U));
+    region[20] = 0U;
+    EXPECT_THAT(rstest_stackUsed(region.data(), region.size()), Eq(44U));
+    region[0] = 0U;
+    EXPECT_THAT(rstest_stackUsed(region.data(), region.size()), Eq(64U));
+}
+
+TEST(RSTestStackPaintTest, ignoresUnalignedEnds)
+{
+    alignas(uint32_t) array<uint8_t, 64> region{};
+    rstest_stackPaint(&(region[1]), 62U);
+    EXPECT_THAT(region[0], Eq(0U));
+    EXPECT_THAT(region[4], Eq(0xA5U));
+    EXPECT_THAT(region[60], Eq(0U));
+    EXPECT_THAT(rstest_stackUsed(&(region[1]), 62U), Eq(0U));
+}
+
+#if defined(RSTEST_STACK_USAGE)
+
+//-----------------------------------------------------------------------------
+class RSTestStackTest : public Test
+{
+public:
+    /// Constructor
+    RSTestStackTest()
+    {
+        m_testSuite.name      = "StackSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+        m_testSuite.stack     = &m_stack;
+    }
+
+    /// Destructor - restore the default depth.
+    ~RSTestStackTest() override { RSTC_stackFrames = 4U; }
+
+protected:
+    /// Stack usage of a test case.
+    /// @param[in] idx index of the test case
+    [[nodiscard]] const TestStackStats_t &stats(size_t idx) const
+    {
+        return rstest_getReport()->caseResults.records[idx].stack;
+    }
+
+    static constexpr size_t StackSize = 64U * 1024U;
+
+    TestCase_t  m_testCases[2] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                  TESTCASE_DEF(RSTC_stack_deep, TestCaseState_Idle)};
+    TestSuite_t m_testSuite{}; ///< TestSuite to use for this test.
+    alignas(16) array<uint8_t, 2U * StackSize> m_memory{}; ///< Stack region (upper half) and overflow guard
+    TestStack_t m_stack{&(m_memory[StackSize]), StackSize, RSTEST_STACK_UNLIMITED, &rstest_stackRunHost, nullptr};
+};
+
+TEST_F(RSTestStackTest, measuresUsage)
+{
+    RSTC_stackFrames = 16U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+
+    EXPECT_THAT(stats(0U).sizeBytes, Eq(StackSize));
+    EXPECT_THAT(stats(0U).usedBytes, AllOf(Gt(0U), Lt(StackSize)));
+    EXPECT_THAT(stats(1U).sizeBytes, Eq(StackSize));
+    EXPECT_THAT(stats(1U).usedBytes, AllOf(Ge(stats(0U).usedBytes + (16U * 256U)), Lt(StackSize)));
+}
+
+TEST_F(RSTestStackTest, failsOverBudget)
+{
+    RSTC_stackFrames     = 32U;
+    m_stack.maxUsedBytes = 4096U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    const TestReport_t *report = rstest_getReport();
+    EXPECT_THAT(report->caseResults.records[0].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(report->caseResults.records[1].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(stats(1U).usedBytes, Gt(4096U));
+}
+
+TEST_F(RSTestStackTest, failsOverflow)
+{
+    // Overflows into the lower half of the memory, not into the test.
+    RSTC_stackFrames = 32U;
+    m_stack.region   = &(m_memory[2U * StackSize - 4096U]);
+    m_stack.size     = 4096U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(rstest_getReport()->caseResults.records[1].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(stats(1U).usedBytes, Gt(4096U - RSTEST_STACK_GUARD));
+}
+
+TEST_F(RSTestStackTest, noStackExecutesInPlace)
+{
+    m_testSuite.stack = nullptr;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(stats(1U).sizeBytes, Eq(0U));
+    EXPECT_THAT(stats(1U).usedBytes, Eq(0U));
+}
+
+#endif // defined(RSTEST_STACK_USAGE)
@@ -0,0 +1,162 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_status.h>
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <string>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestStatusTest : public Test
+{
+public:
+    /// Constructor
+    RSTestStatusTest()
+    {
+        m_testSuite.name          = "StatusSuite";
+        m_testSuite.testCases     = &(m_testCases[0]);
+        m_testSuite.count         = ARRAY_SIZE(m_testCases);
+        m_testSuite.failureCb     = &RSTestStatusTest::failureCallback;
+        m_testSuite.failureCbUser = this;
+    }
+
+    /// Destructor - stop updating the status block.
+    ~RSTestStatusTest() override { rstest_setStatus(nullptr); }
+
+protected:
+    /// Failure Callback function - captures the live status at the failure.
+    static void failureCallback(const AssertRecord_t *record, void *user)
+    {
+        auto that = reinterpret_cast<RSTestStatusTest *>(user);
+        (void)record;
+        EXPECT_THAT(rstest_statusRead(&(that->m_status), &(that->m_atFailure)), IsTrue());
+    }
+
+    TestCase_t   m_testCases[4] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                   TESTCASE_DEF(RSTC_fail_assert_pass_end, TestCaseState_Idle),
+                                   TESTCASE_DEF(RSTC_fail_end, TestCaseState_Disabled),
+                                   TESTCASE_PARAM_DEF(RSTC_param_sum_commutes, RSTC_sumVectors,
+                                                      ARRAY_SIZE(RSTC_sumVectors), TestCaseState_Idle)};
+    TestSuite_t  m_testSuite{};  ///< TestSuite to use for this test.
+    TestStatus_t m_status{};     ///< Live status block
+    TestStatus_t m_atFailure{};  ///< Status block copy at the failure
+};
+
+TEST_F(RSTestStatusTest, tracksRun)
+{
+    rstest_setStatus(&m_status);
+    EXPECT_THAT(m_status.magic, Eq(RSTEST_STATUS_MAGIC));
+    EXPECT_THAT(m_status.caseIndex, Eq(RSTEST_STATUS_NO_CASE));
+
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    // Live while the failing test case executes.
+    EXPECT_THAT(m_atFailure.running, Eq(1U));
+    EXPECT_THAT(m_atFailure.caseIndex, Eq(1U));
+    EXPECT_THAT(m_atFailure.caseName, StrEq("RSTC_fail_assert_pass_end"));
+    EXPECT_THAT(m_atFailure.stateCount[TestCaseState_Pass], Eq(1U));
+    EXPECT_THAT(m_atFailure.stateCount[TestCaseState_Executing], Eq(1U));
+    EXPECT_THAT(m_atFailure.stateCount[TestCaseState_Idle], Eq(2U));
+    EXPECT_THAT(m_atFailure.lastFailure.caseIndex, Eq(1U));
+    EXPECT_THAT(m_atFailure.lastFailure.file, StrEq("example_test_suite.c"));
+
+    // Complete
+    TestStatus_t status{};
+    ASSERT_THAT(rstest_statusRead(&m_status, &status), IsTrue());
+    EXPECT_THAT(status.sequence % 2U, Eq(0U));
+    EXPECT_THAT(status.running, Eq(0U));
+    EXPECT_THAT(status.runCount, Eq(1U));
+    EXPECT_THAT(status.caseCount, Eq(4U));
+    EXPECT_THAT(status.suiteName, StrEq("StatusSuite"));
+    EXPECT_THAT(status.stateCount[TestCaseState_Idle], Eq(0U));
+    EXPECT_THAT(status.stateCount[TestCaseState_Executing], Eq(0U));
+    EXPECT_THAT(status.stateCount[TestCaseState_Pass], Eq(2U));
+    EXPECT_THAT(status.stateCount[TestCaseState_Fail], Eq(1U));
+    EXPECT_THAT(status.stateCount[TestCaseState_Disabled], Eq(1U));
+    EXPECT_THAT(status.failAssertCount, Eq(1U));
+    EXPECT_THAT(status.lastFailure.line, Eq(rstest_getReport()->failAsserts.records[0].line));
+}
+
+TEST_F(RSTestStatusTest, neverEndedCountsFailed)
+{
+    // Returns without END_TESTCASE_PASS() and without a failing assertion.
+    m_testCases[1] = TESTCASE_DEF(RSTC_no_end, TestCaseState_Idle);
+    rstest_setStatus(&m_status);
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    TestStatus_t status{};
+    ASSERT_THAT(rstest_statusRead(&m_status, &status), IsTrue());
+    EXPECT_THAT(status.stateCount[TestCaseState_Executing], Eq(0U));
+    EXPECT_THAT(status.stateCount[TestCaseState_Fail], Eq(1U));
+    EXPECT_THAT(status.failAssertCount, Eq(0U));
+    EXPECT_THAT(rstest_getReport()->caseResults.records[1].state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+}
+
+TEST_F(RSTestStatusTest, inconsistentNotRead)
+{
+    TestStatus_t status{};
+    EXPECT_THAT(rstest_statusRead(&m_status, &status), IsFalse()); // Not initialized
+
+    rstest_setStatus(&m_status);
+    EXPECT_THAT(rstest_statusRead(&m_status, &status), IsTrue());
+
+    m_status.sequence = m_status.sequence + 1U; // Writer mid update.
+    EXPECT_THAT(rstest_statusRead(&m_status, &status), IsFalse());
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_F(RSTestStatusTest, mappedFile)
+{
+    const std::string path = ::testing::TempDir() + "rstest_status_test.bin";
+    (void)std::remove(path.c_str());
+    EXPECT_THAT(rstest_statusMapFile(path.c_str(), false), IsNull());
+
+    TestStatus_t *writer = rstest_statusMapFile(path.c_str(), true);
+    ASSERT_THAT(writer, NotNull());
+    TestStatus_t *reader = rstest_statusMapFile(path.c_str(), false);
+    ASSERT_THAT(reader, NotNull());
+
+    rstest_setStatus(writer);
+    m_testCases[1].state = TestCaseState_Disabled;
+    EXPECT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    TestStatus_t status{};
+    ASSERT_THAT(rstest_statusRead(reader, &status), IsTrue());
+    EXPECT_THAT(status.runCount, Eq(1U));
+    EXPECT_THAT(status.stateCount[TestCaseState_Pass], Eq(2U));
+    EXPECT_THAT(status.failAssertCount, Eq(0U));
+
+    rstest_setStatus(nullptr);
+    rstest_statusUnmapFile(reader);
+    rstest_statusUnmapFile(writer);
+    (void)std::remove(path.c_str());
+}
+#endif
@@ -0,0 +1,241 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+#include "example_test_suite.h"
+
+#include <gmock/gmock.h>
+
+#include <atomic>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestStressTest : public Test
+{
+public:
+    /// Constructor
+    RSTestStressTest()
+    {
+        m_testSuite.name        = "StressSuite";
+        m_testSuite.testCases   = &(m_testCases[0]);
+        m_testSuite.count       = ARRAY_SIZE(m_testCases);
+        m_testSuite.clockCb     = &RSTestStressTest::clockCallback;
+        m_testSuite.clockCbUser = this;
+        rstest_setStressRunner(&RSTestStressTest::runner, this);
+        for (uint32_t &count : RSTC_stressCounts)
+        {
+            count = 0U;
+        }
+    }
+
+    /// Destructor
+    ~RSTestStressTest() override { rstest_setStressRunner(NULL, NULL); }
+
+    RSTestStressTest(const RSTestStressTest &)            = delete;
+    RSTestStressTest &operator=(const RSTestStressTest &) = delete;
+    RSTestStressTest(RSTestStressTest &&)                 = delete;
+    RSTestStressTest &operator=(RSTestStressTest &&)      = delete;
+
+protected:
+    /// Clock Callback - each thread has its own simulated time, advancing 1000 ticks a read.
+    static uint64_t clockCallback(void * /*user*/)
+    {
+        static thread_local uint64_t now = 0U;
+        const uint64_t               at  = now;
+        now += 1000U;
+        return at;
+    }
+
+    /// Stress Runner Callback - counts the threads entering the worker, then the host runner.
+    static bool runner(uint32_t threads, TestStressWorker_t worker, void *arg, void *user)
+    {
+        auto *self = reinterpret_cast<RSTestStressTest *>(user);
+        if (!self->m_runnerStarts)
+        {
+            return false;
+        }
+        self->m_worker    = worker;
+        self->m_workerArg = arg;
+        return rstest_stressRunHost(threads, &RSTestStressTest::countedWorker, self, NULL);
+    }
+
+    /// Worker counting the threads entering it.
+    static void countedWorker(uint32_t thread, void *arg)
+    {
+        auto *self = reinterpret_cast<RSTestStressTest *>(arg);
+        self->m_entered++;
+        self->m_worker(thread, self->m_workerArg);
+    }
+
+    /// Body - checks every thread entered the worker before the first iteration.
+    static void body(uint32_t /*thread*/, uint32_t iteration, void *user)
+    {
+        auto *self = reinterpret_cast<RSTestStressTest *>(user);
+        if (iteration == 0U)
+        {
+            EXPECT_THAT(self->m_entered.load(), Eq(self->m_stress.threads));
+        }
+        self->m_ops++;
+    }
+
+    /// Result of the stress test case after the run.
+    [[nodiscard]] static const TestCaseResult_t &result() { return rstest_getReport()->caseResults.records[1]; }
+
+    uint64_t           m_threadOps[4] = {}; ///< Operations per second of each thread
+    TestStressResult_t m_result{};          ///< Throughput of the stress test case
+    TestStress_t       m_stress{&RSTestStressTest::body, this, 4U, 500U, 1000000U, &(m_threadOps[0]), &m_result};
+    TestCase_t         m_testCases[2] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                         TESTCASE_STRESS_DEF(RSTC_stress, m_stress, TestCaseState_Idle)};
+    TestSuite_t        m_testSuite{};               ///< TestSuite to use for this test.
+    bool               m_runnerStarts = true;       ///< Runner starts the threads
+    TestStressWorker_t m_worker       = NULL;       ///< Worker of the stress test case
+    void              *m_workerArg    = NULL;       ///< Argument of the worker
+    atomic<uint32_t>   m_entered{0U};               ///< Threads that entered the worker
+    atomic<uint32_t>   m_ops{0U};                   ///< Iterations executed by all threads
+};
+
+TEST_F(RSTestStressTest, runsEveryThread)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().name, StrEq("RSTC_stress"));
+    EXPECT_THAT(result().state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(m_entered.load(), Eq(4U));
+    EXPECT_THAT(m_ops.load(), Eq(4U * 500U));
+    EXPECT_THAT(rstest_getReport()->failAsserts.count, Eq(0U));
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+}
+
+TEST_F(RSTestStressTest, reportsOpsPerSec)
+{
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    // Each thread: 500 iterations in 1000 ticks of a 1MHz clock, all threads over the same 1000 ticks.
+    EXPECT_THAT(m_result.threads, Eq(4U));
+    EXPECT_THAT(m_result.minOpsPerSec, Eq(500000U));
+    EXPECT_THAT(m_result.opsPerSec, Eq(4U * 500000U));
+    EXPECT_THAT(m_threadOps, Each(Eq(500000U)));
+}
+
+TEST_F(RSTestStressTest, failsOnThread)
+{
+    // Thread 4 of the example fails each of its iterations, the other threads pass.
+    m_stress       = {&RSTC_stress_count, NULL, 5U, 100U, 0U, NULL, NULL};
+    m_testCases[1] = TESTCASE_STRESS_DEF(RSTC_stress_count, m_stress, TestCaseState_Idle);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(RSTC_stressCounts, Each(Eq(100U)));
+    EXPECT_THAT(rstest_getReport()->failAsserts.count, Eq(100U));
+    EXPECT_THAT(rstest_testSuitePassed(), IsFalse());
+}
+
+TEST_F(RSTestStressTest, failureCallbackMayAssert)
+{
+    // The failure callback records an assertion of its own - not under the lock of the failure.
+    static atomic<uint32_t> failures{0U};
+    failures              = 0U;
+    m_testSuite.failureCb = [](const AssertRecord_t *record, void * /*user*/) {
+        failures++;
+        (void)rstest_assertTrue(record, true);
+    };
+    m_stress       = {&RSTC_stress_count, NULL, 5U, 100U, 0U, NULL, NULL};
+    m_testCases[1] = TESTCASE_STRESS_DEF(RSTC_stress_count, m_stress, TestCaseState_Idle);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(failures.load(), Eq(100U));
+    EXPECT_THAT(rstest_getReport()->failAsserts.count, Eq(100U));
+    // The end of RSTC_pass_end, then one of each callback.
+    EXPECT_THAT(rstest_getReport()->passAsserts.count, Eq(1U + 100U));
+}
+
+TEST_F(RSTestStressTest, failsWithoutRunner)
+{
+    rstest_setStressRunner(NULL, NULL);
+    m_result.threads = 1U; // Overwritten by the execution.
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_result.threads, Eq(0U));
+    EXPECT_THAT(m_ops.load(), Eq(0U));
+}
+
+TEST_F(RSTestStressTest, failsBeyondMaxThreads)
+{
+    m_stress.threads = RSTEST_STRESS_MAX_THREADS + 1U;
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_entered.load(), Eq(0U));
+}
+
+TEST_F(RSTestStressTest, failsWhenThreadsNotStarted)
+{
+    m_runnerStarts   = false;
+    m_result.threads = 1U; // Overwritten by the execution.
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Fail));
+    EXPECT_THAT(m_result.threads, Eq(0U));
+    EXPECT_THAT(m_ops.load(), Eq(0U));
+}
+
+TEST_F(RSTestStressTest, exampleCountsEachThread)
+{
+    TestStress_t stress = RSTC_stress_counts;
+    stress.result       = &m_result;
+    m_testCases[1]      = TESTCASE_STRESS_DEF(RSTC_stress_counts, stress, TestCaseState_Idle);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(m_result.threads, Eq(4U));
+    EXPECT_THAT(m_result.opsPerSec, Eq(0U)); // No clock frequency.
+    EXPECT_THAT(RSTC_stressCounts, Each(Eq(1000U)));
+    // Every passing assertion of the threads is counted - 2 an iteration, and 2 of the stress test case.
+    EXPECT_THAT(rstest_getReport()->passAssertCount, Eq((4U * 1000U * 2U) + 2U));
+}
+
+TEST_F(RSTestStressTest, recordsHeapAndTimingOfEveryThread)
+{
+    m_testCases[1] = TESTCASE_STRESS_DEF(RSTC_stress_alloc, RSTC_stress_allocs, TestCaseState_Idle);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(result().state, Eq(TestCaseState_Pass));
+    const TestTimingList_t &timing = rstest_getReport()->timing;
+    ASSERT_THAT(timing.count, Eq(1U));
+    EXPECT_THAT(timing.records[0].runs, Eq(4U * 1000U));
+    EXPECT_THAT(timing.records[0].exceeded, Eq(0U));
+#if defined(RSTEST_HEAP_TRACKING)
+    EXPECT_THAT(result().heap.allocCount, Eq(4U * 1000U));
+    EXPECT_THAT(result().heap.freeCount, Eq(4U * 1000U));
+    EXPECT_THAT(result().heap.leakedBytes, Eq(0U));
+#endif // defined(RSTEST_HEAP_TRACKING)
+}
@@ -0,0 +1,166 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_time.h>
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestTimeTest : public Test
+{
+public:
+    /// Constructor
+    RSTestTimeTest()
+    {
+        m_testSuite.name      = "TimeSuite";
+        m_testSuite.testCases = &(m_testCases[0]);
+        m_testSuite.count     = ARRAY_SIZE(m_testCases);
+        rstest_timeReset();
+        RSTC_retryFailures = 3U;
+    }
+
+protected:
+    /// Timer Callback - records the virtual time of each expiry, stops after m_stopAfter.
+    static void timerCallback(TestTimer_t *timer, void *user)
+    {
+        auto *self = reinterpret_cast<RSTestTimeTest *>(user);
+        self->m_expired.push_back(rstest_now());
+        self->m_timers.push_back(timer);
+        if (self->m_expired.size() == self->m_stopAfter)
+        {
+            rstest_timerStop(timer);
+        }
+    }
+
+    /// Timer Callback - restarts the timer with twice the delay (back-off) until m_stopAfter.
+    static void backoffCallback(TestTimer_t *timer, void *user)
+    {
+        auto *self = reinterpret_cast<RSTestTimeTest *>(user);
+        self->m_expired.push_back(rstest_now());
+        if (self->m_expired.size() < self->m_stopAfter)
+        {
+            rstest_timerStart(timer, 100U << self->m_expired.size(), 0U, &RSTestTimeTest::backoffCallback, self);
+        }
+    }
+
+    TestTimer_t           m_timer[3]     = {};       ///< Timers of the test
+    vector<uint64_t>      m_expired;                ///< Virtual time of each expiry
+    vector<TestTimer_t *> m_timers;                 ///< Timer of each expiry
+    size_t                m_stopAfter    = SIZE_MAX; ///< Expiries before the callback stops the timer
+    TestCase_t            m_testCases[2] = {TESTCASE_DEF(RSTC_retry_backoff, TestCaseState_Idle),
+                                            TESTCASE_DEF(RSTC_retry_backoff, TestCaseState_Idle)};
+    TestSuite_t           m_testSuite{};            ///< TestSuite to use for this test.
+};
+
+TEST_F(RSTestTimeTest, sleepAdvancesWithoutWaiting)
+{
+    EXPECT_THAT(rstest_now(), Eq(0U));
+    rstest_sleep(5000U);
+    rstest_sleep(250U);
+    EXPECT_THAT(rstest_now(), Eq(5250U));
+    EXPECT_THAT(rstest_sleepUntilNext(), IsFalse());
+    EXPECT_THAT(rstest_now(), Eq(5250U));
+}
+
+TEST_F(RSTestTimeTest, expiresInDeadlineOrder)
+{
+    rstest_sleep(10U);
+    rstest_timerStart(&m_timer[0], 300U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_timerStart(&m_timer[1], 100U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_timerStart(&m_timer[2], 300U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_sleep(1000U);
+
+    EXPECT_THAT(m_expired, ElementsAre(110U, 310U, 310U));
+    EXPECT_THAT(m_timers, ElementsAre(&m_timer[1], &m_timer[0], &m_timer[2]));
+    EXPECT_THAT(rstest_now(), Eq(1010U));
+    EXPECT_THAT(m_timer[0].pending, IsFalse());
+}
+
+TEST_F(RSTestTimeTest, sleepUntilNextJumpsToDeadline)
+{
+    rstest_timerStart(&m_timer[0], 250U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_timerStart(&m_timer[1], 250U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_timerStart(&m_timer[2], 900U, 0U, &RSTestTimeTest::timerCallback, this);
+
+    EXPECT_THAT(rstest_sleepUntilNext(), IsTrue());
+    EXPECT_THAT(rstest_now(), Eq(250U));
+    EXPECT_THAT(m_expired, ElementsAre(250U, 250U));
+    EXPECT_THAT(rstest_sleepUntilNext(), IsTrue());
+    EXPECT_THAT(rstest_now(), Eq(900U));
+    EXPECT_THAT(rstest_sleepUntilNext(), IsFalse());
+}
+
+TEST_F(RSTestTimeTest, periodicUntilStopped)
+{
+    m_stopAfter = 3U;
+    rstest_timerStart(&m_timer[0], 50U, 100U, &RSTestTimeTest::timerCallback, this);
+    rstest_sleep(1000U);
+
+    EXPECT_THAT(m_expired, ElementsAre(50U, 150U, 250U));
+    EXPECT_THAT(m_timer[0].pending, IsFalse());
+}
+
+TEST_F(RSTestTimeTest, stopAndRestart)
+{
+    rstest_timerStart(&m_timer[0], 100U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_timerStart(&m_timer[1], 200U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_timerStop(&m_timer[0]);
+    rstest_timerStop(&m_timer[0]);
+    rstest_sleep(50U);
+    // Restarting a pending timer moves its deadline.
+    rstest_timerStart(&m_timer[1], 500U, 0U, &RSTestTimeTest::timerCallback, this);
+    rstest_sleep(1000U);
+
+    EXPECT_THAT(m_expired, ElementsAre(550U));
+    EXPECT_THAT(m_timers, ElementsAre(&m_timer[1]));
+}
+
+TEST_F(RSTestTimeTest, callbackRestartsTimer)
+{
+    m_stopAfter = 4U;
+    rstest_timerStart(&m_timer[0], 100U, 0U, &RSTestTimeTest::backoffCallback, this);
+    rstest_sleep(10000U);
+
+    EXPECT_THAT(m_expired, ElementsAre(100U, 300U, 700U, 1500U));
+    EXPECT_THAT(rstest_now(), Eq(10000U));
+}
+
+TEST_F(RSTestTimeTest, resetsPerTestCase)
+{
+    // A timer pending before the run is dropped by the reset of the first test case.
+    rstest_sleep(123U);
+    rstest_timerStart(&m_timer[0], 100U, 0U, &RSTestTimeTest::timerCallback, this);
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    // Each test case checks the virtual time from 0.
+    EXPECT_THAT(rstest_getReport()->caseResults.records[0].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(rstest_getReport()->caseResults.records[1].state, Eq(TestCaseState_Pass));
+    EXPECT_THAT(rstest_testSuitePassed(), IsTrue());
+    EXPECT_THAT(m_expired, IsEmpty());
+}
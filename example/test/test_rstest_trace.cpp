@@ -0,0 +1,160 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+#include "example_test_suite.h"
+
+#include <rstest/rstest_trace.h>
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace ::std;
+using namespace ::testing;
+
+//-----------------------------------------------------------------------------
+class RSTestTraceTest : public Test
+{
+public:
+    /// Constructor
+    RSTestTraceTest()
+    {
+        m_testSuite.name          = "TraceSuite";
+        m_testSuite.testCases     = &(m_testCases[0]);
+        m_testSuite.count         = ARRAY_SIZE(m_testCases);
+        m_testSuite.failureCb     = &RSTestTraceTest::failureCallback;
+        m_testSuite.failureCbUser = this;
+    }
+
+    /// Destructor - stop recording the trace.
+    ~RSTestTraceTest() override { (void)rstest_setTrace(nullptr); }
+
+protected:
+    /// Clock Callback - a tick per read.
+    static uint64_t clockCallback(void *user) { return (*reinterpret_cast<uint64_t *>(user))++; }
+
+    /// Failure Callback function - nothing to do, traced.
+    static void failureCallback(const AssertRecord_t *record, void *user)
+    {
+        (void)record;
+        (void)user;
+    }
+
+    /// Kept events of the trace as (kind, begin, caseIndex, worker).
+    [[nodiscard]] vector<tuple<int, bool, uint32_t, uint16_t>> events() const
+    {
+        vector<tuple<int, bool, uint32_t, uint16_t>> kept;
+        for (uint32_t idx = 0U; idx < rstest_traceCount(&m_trace); idx++)
+        {
+            const TestTraceEvent_t *event = rstest_traceGet(&m_trace, idx);
+            kept.emplace_back(event->kind, event->begin != 0U, event->caseIndex, event->worker);
+        }
+        return kept;
+    }
+
+    TestCase_t       m_testCases[3] = {TESTCASE_DEF(RSTC_pass_end, TestCaseState_Idle),
+                                       TESTCASE_DEF(RSTC_fail_end, TestCaseState_Idle),
+                                       TESTCASE_ASYNC_DEF(RSTC_async_wait2, TestCaseState_Idle)};
+    TestSuite_t      m_testSuite{};  ///< TestSuite to use for this test.
+    uint64_t         m_ticks = 0U;   ///< Clock of the trace
+    TestTraceEvent_t m_events[64]{}; ///< Trace ring buffer
+    TestTrace_t      m_trace{&(m_events[0]), ARRAY_SIZE(m_events), 0U, &RSTestTraceTest::clockCallback, &m_ticks};
+};
+
+TEST_F(RSTestTraceTest, recordsRun)
+{
+    ASSERT_THAT(rstest_setTrace(&m_trace), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    constexpr uint32_t NoCase = RSTEST_TRACE_NO_CASE;
+    const auto         kept   = events();
+    ASSERT_THAT(kept.size(), Ge(18U));
+    EXPECT_THAT(vector(kept.begin(), kept.begin() + 15),
+                ElementsAre(tuple(TestTraceKind_Suite, true, NoCase, 0U),
+                            // RSTC_pass_end
+                            tuple(TestTraceKind_Startup, true, 0U, 0U), tuple(TestTraceKind_Startup, false, 0U, 0U),
+                            tuple(TestTraceKind_Body, true, 0U, 0U), tuple(TestTraceKind_Body, false, 0U, 0U),
+                            tuple(TestTraceKind_Teardown, true, 0U, 0U), tuple(TestTraceKind_Teardown, false, 0U, 0U),
+                            // RSTC_fail_end - the failure callback within the body
+                            tuple(TestTraceKind_Startup, true, 1U, 0U), tuple(TestTraceKind_Startup, false, 1U, 0U),
+                            tuple(TestTraceKind_Body, true, 1U, 0U), tuple(TestTraceKind_Failure, true, 1U, 0U),
+                            tuple(TestTraceKind_Failure, false, 1U, 0U), tuple(TestTraceKind_Body, false, 1U, 0U),
+                            tuple(TestTraceKind_Teardown, true, 1U, 0U), tuple(TestTraceKind_Teardown, false, 1U, 0U)));
+    // RSTC_async_wait2 on async worker 1, resumed several times.
+    EXPECT_THAT(kept[15], Eq(tuple(TestTraceKind_Startup, true, 2U, 1U)));
+    EXPECT_THAT(kept.back(), Eq(tuple(TestTraceKind_Suite, false, NoCase, 0U)));
+
+    // Timestamps in order.
+    for (uint32_t idx = 1U; idx < rstest_traceCount(&m_trace); idx++)
+    {
+        EXPECT_THAT(rstest_traceGet(&m_trace, idx)->time, Gt(rstest_traceGet(&m_trace, idx - 1U)->time));
+    }
+}
+
+TEST_F(RSTestTraceTest, ringKeepsLatest)
+{
+    m_trace.capacity = 4U;
+    ASSERT_THAT(rstest_setTrace(&m_trace), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    EXPECT_THAT(m_trace.head, Gt(4U));
+    ASSERT_THAT(rstest_traceCount(&m_trace), Eq(4U));
+    EXPECT_THAT(events().back(), Eq(tuple(TestTraceKind_Suite, false, RSTEST_TRACE_NO_CASE, 0U)));
+}
+
+TEST_F(RSTestTraceTest, capacityPowerOf2)
+{
+    m_trace.capacity = 48U;
+    EXPECT_THAT(rstest_setTrace(&m_trace), IsFalse());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+    EXPECT_THAT(m_trace.head, Eq(0U));
+}
+
+TEST_F(RSTestTraceTest, exportChromeTrace)
+{
+    ASSERT_THAT(rstest_setTrace(&m_trace), IsTrue());
+    ASSERT_THAT(rstest_init(&m_testSuite), IsTrue());
+    EXPECT_THAT(rstest_run(), IsTrue());
+
+    const string path = ::testing::TempDir() + "rstest_trace_test.json";
+    ASSERT_THAT(rstest_traceExport(&m_trace, path.c_str(), 1000U), IsTrue());
+    stringstream content;
+    content << ifstream(path).rdbuf();
+    (void)remove(path.c_str());
+
+    EXPECT_THAT(content.str(), StartsWith("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"));
+    EXPECT_THAT(content.str(), HasSubstr("{\"name\":\"TraceSuite\",\"cat\":\"suite\",\"ph\":\"B\",\"ts\":0.000,"
+                                         "\"pid\":1,\"tid\":0}"));
+    EXPECT_THAT(content.str(), HasSubstr("{\"name\":\"RSTC_pass_end\",\"cat\":\"startup\",\"ph\":\"B\",\"ts\":0.001,"
+                                         "\"pid\":1,\"tid\":0,\"args\":{\"case\":0}}"));
+    EXPECT_THAT(content.str(), HasSubstr("\"cat\":\"failure\",\"ph\":\"E\""));
+    EXPECT_THAT(content.str(), HasSubstr("\"name\":\"RSTC_async_wait2\",\"cat\":\"body\",\"ph\":\"B\""));
+    EXPECT_THAT(content.str(), EndsWith("}\n]}\n"));
+
+    EXPECT_THAT(rstest_traceExport(&m_trace, "/nonexistent/rstest_trace.json", 1000U), IsFalse());
+}
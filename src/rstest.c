@@ -23,8 +23,31 @@
 //
 
 #include "rstest/rstest.h"
+#include "rstest/rstest_baseline.h"
+#include "rstest/rstest_budget.h"
+#include "rstest/rstest_checkpoint.h"
+#include "rstest/rstest_time.h"
+#include "rstest/rstest_trace.h"
+#include "rstest_internal.h"
 
 #include <assert.h>
+#include <string.h>
+#include <stdlib.h>
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Serialize the recording of assertions - stress test case bodies assert from several threads.
+#if defined(__GNUC__) || defined(__clang__)
+#define ASSERT_LOCK()                                              \
+    while (__atomic_test_and_set(&k_assertLock, __ATOMIC_ACQUIRE)) \
+    {                                                              \
+    }
+#define ASSERT_UNLOCK() __atomic_clear(&k_assertLock, __ATOMIC_RELEASE)
+#else
+#define ASSERT_LOCK()
+#define ASSERT_UNLOCK()
+#endif
 
 // ------------------------------------------------------------------
 // Local Types
@@ -53,12 +76,34 @@ typedef enum TestSuiteState_e
 /// Test Suite info Structure
 typedef struct TestInfo_s
 {
-    const TestSuite_t *testSuite; ///< Test Suite information.
-    TestCase_t        *current;   ///< Current TestCase
-    TestReport_t       report;    ///< Report for this test case - only valid once complete
-    TestSuiteState_t   state;     ///< Test Suite State
+    const TestSuite_t       *testSuite;      ///< Test Suite information.
+    TestCase_t              *current;        ///< Current TestCase
+    uint32_t                 param;          ///< Current parameter index of a parameterized TestCase
+    bool                     abortOnFailure; ///< Abort on the first failure (fuzzing)
+    bool                     fixtureStarted; ///< Fixture startup executed (rstest_executeParam())
+    bool                     snapshotTaken;  ///< Snapshot regions captured after the startup callback
+    uint16_t                 worker;         ///< Worker of the current test case (trace), async slot + 1
+    bool                     resumed;        ///< Continuing an interrupted run (rstest_resume())
+    void                    *fixture;        ///< Fixture context of the test suite
+    uint32_t                 suiteHash;      ///< Hash of the test suite names (checkpoint)
+    TestCheckpointCounters_t base;           ///< Report counters before the run (checkpoint)
+    bool                     budgeted;       ///< Time budgeted run (rstest_runBudget())
+    uint64_t                 budgetStart;    ///< Clock at the start of the time budgeted run
+    uint64_t                 budgetLimit;    ///< Time budget in clock ticks
+    uint64_t                 bodyStart;      ///< Clock at the start of the test case body
+    uint64_t                 bodyTicks;      ///< Duration of the body of the current test case (deadline)
+    TestReport_t             report;         ///< Report for this test case - only valid once complete
+    TestSuiteState_t         state;          ///< Test Suite State
 } TestInfo_t;
 
+/// Async Test Case execution slot
+typedef struct AsyncSlot_s
+{
+    TestCase_t *testCase; ///< Executing async TestCase, NULL when slot is free
+    TestAsync_t async;    ///< Resume context of the TestCase
+    uint64_t    start;    ///< Clock at the start of the TestCase
+} AsyncSlot_t;
+
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
@@ -69,18 +114,807 @@ typedef struct TestInfo_s
 // Test Suite State Control Block (Singleton)
 static TestInfo_t k_info = {0};
 
+// Lock of the recording of assertions (ASSERT_LOCK).
+static bool k_assertLock = false;
+
+// Execution order and expected durations of a time budgeted run.
+static uint32_t k_budgetOrder[RSTEST_BUDGET_MAX_CASES];
+static uint64_t k_budgetExpected[RSTEST_BUDGET_MAX_CASES];
+
+// ------------------------------------------------------------------
+// Global Variables
+
+uint32_t rstest_assertPassCount = 0U;
+bool     rstest_assertThreaded  = false;
+
 // ------------------------------------------------------------------
 // Local Functions
 
-/// Add an assertion record to the appropriate list.
-/// If it is a failure change the state of the current test case.
-static void addAssertion(const AssertRecord_t *rec, bool cond)
+/// Get the index of a test case within the test suite.
+/// @param[in] testCase test case of the test suite
+/// @returns the index of the test case
+static size_t indexOf(const TestCase_t *testCase)
+{
+    assert(testCase != NULL);
+    return (size_t)(testCase - k_info.testSuite->testCases);
+}
+
+/// Get the result record of a test case.
+/// @param[in] testCase test case of the test suite
+/// @returns NULL if the test case index is beyond MAX_NUM_TESTCASE_RESULTS
+static TestCaseResult_t *resultOf(const TestCase_t *testCase)
+{
+    const size_t index = indexOf(testCase);
+    return (index < MAX_NUM_TESTCASE_RESULTS) ? &(k_info.report.caseResults.records[index]) : NULL;
+}
+
+/// Get the result record of the current test case.
+/// @returns NULL if the test case index is beyond MAX_NUM_TESTCASE_RESULTS
+static TestCaseResult_t *currentResult(void) { return resultOf(k_info.current); }
+
+/// Find a test case of the test suite by its name.
+/// @param[in] name name of the test case
+/// @returns the test case, NULL when not found
+static const TestCase_t *findTestCase(const char *name)
+{
+    const TestCase_t *begin = k_info.testSuite->testCases;
+    const TestCase_t *end   = begin + k_info.testSuite->count;
+    for (const TestCase_t *testCase = begin; testCase < end; testCase++)
+    {
+        if ((testCase->name != NULL) && (strcmp(testCase->name, name) == 0))
+        {
+            return testCase;
+        }
+    }
+    return NULL;
+}
+
+/// State of the prerequisites of a test case.
+/// @param[in] testCase test case of the test suite
+/// @retval TestCaseState_Pass when every prerequisite passed (or none)
+/// @retval TestCaseState_Idle when a prerequisite is still to be executed
+/// @retval TestCaseState_Blocked when a prerequisite did not pass, or does not exist
+static TestCaseState_t dependsState(const TestCase_t *testCase)
+{
+    TestCaseState_t state = TestCaseState_Pass;
+    for (const char *const *name = testCase->depends; (name != NULL) && (*name != NULL); name++)
+    {
+        const TestCase_t     *depend      = findTestCase(*name);
+        const TestCaseState_t dependState = (depend != NULL) ? depend->state : TestCaseState_Blocked;
+        if ((dependState == TestCaseState_Idle) || (dependState == TestCaseState_Executing))
+        {
+            state = TestCaseState_Idle;
+        }
+        else if (dependState != TestCaseState_Pass)
+        {
+            return TestCaseState_Blocked;
+        }
+    }
+    return state;
+}
+
+/// Dependency level of a test case - one more than the highest of its prerequisites.
+/// @param[in] testCase test case of the test suite
+/// @returns 0 for a test case without prerequisites
+static uint32_t dependsLevel(const TestCase_t *testCase)
+{
+    uint32_t level = 0U;
+    for (const char *const *name = testCase->depends; (name != NULL) && (*name != NULL); name++)
+    {
+        const TestCase_t       *depend = findTestCase(*name);
+        const TestCaseResult_t *result = (depend != NULL) ? resultOf(depend) : NULL;
+        const uint32_t          above  = (result != NULL) ? (result->level + 1U) : 1U;
+        level                          = (above > level) ? above : level;
+    }
+    return level;
+}
+
+/// Update the result record with the current test case.
+/// @param[in,out] result result record to update (may be NULL)
+static void updateResult(TestCaseResult_t *result)
+{
+    if (result != NULL)
+    {
+        result->name  = k_info.current->name;
+        result->state = k_info.current->state;
+        result->level = dependsLevel(k_info.current);
+        if (k_info.current->paramFunc == NULL)
+        {
+            result->paramCount     = 0U;
+            result->paramFailCount = 0U;
+            result->paramFirstFail = RSTEST_NO_PARAM;
+        }
+    }
+}
+
+/// Read the clock of the test suite.
+/// @returns the clock, 0 when the test suite has no clock.
+static uint64_t readClock(void)
+{
+    TestClockCb_t clockCb = k_info.testSuite->clockCb;
+    return (clockCb != NULL) ? clockCb(k_info.testSuite->clockCbUser) : 0U;
+}
+
+/// Record the duration of a test case execution - the minimum over the runs is kept.
+/// @param[in,out] result result record of the test case (may be NULL)
+/// @param[in] start clock at the start of the test case
+static void recordDuration(TestCaseResult_t *result, uint64_t start)
+{
+    if ((result == NULL) || (k_info.testSuite->clockCb == NULL))
+    {
+        return;
+    }
+    const uint64_t duration = readClock() - start;
+    if ((result->durationRuns == 0U) || (duration < result->duration))
+    {
+        result->duration = duration;
+    }
+    result->durationRuns++;
+}
+
+/// Record a timed execution into the timing records of the report - worst time over the runs.
+/// Under ASSERT_LOCK - a stress test case body may time its sites on several threads.
+/// @param[in] name file of the site, test case name of a test case deadline
+/// @param[in] line line of the site, 0 for a test case deadline
+/// @param[in] elapsed time of the execution in clock ticks
+/// @param[in] deadline deadline in clock ticks
+static void recordTiming(const char *name, uint32_t line, uint64_t elapsed, uint64_t deadline)
+{
+    ASSERT_LOCK();
+    TestTimingList_t   *list   = &(k_info.report.timing);
+    TestTimingRecord_t *record = NULL;
+    for (size_t idx = 0U; (idx < list->count) && (record == NULL); idx++)
+    {
+        TestTimingRecord_t *site = &(list->records[idx]);
+        if ((site->line == line) && ((site->name == name) || (strcmp(site->name, name) == 0)))
+        {
+            record = site;
+        }
+    }
+    if ((record == NULL) && (list->count < MAX_NUM_TIMING_SITES))
+    {
+        record  = &(list->records[list->count]);
+        *record = (TestTimingRecord_t){name, line, 0U, 0U, 0U, 0U, 0};
+        list->count++;
+    }
+    if (record != NULL)
+    {
+        record->runs++;
+        record->exceeded += (elapsed > deadline) ? 1U : 0U;
+        record->deadline = deadline;
+        record->worst    = (elapsed > record->worst) ? elapsed : record->worst;
+        record->margin   = (int64_t)(record->deadline - record->worst);
+    }
+    ASSERT_UNLOCK();
+}
+
+/// Check the deadline of the current test case against the duration of its body.
+static void checkDeadline(void)
+{
+    const uint64_t deadline = k_info.current->deadline;
+    if ((deadline == 0U) || (k_info.testSuite->clockCb == NULL))
+    {
+        return;
+    }
+    recordTiming(k_info.current->name, 0U, k_info.bodyTicks, deadline);
+    if (k_info.bodyTicks > deadline)
+    {
+        const AssertRecord_t rec = {k_info.current->name, 0U, RSTEST_NO_PARAM, AssertKind_Timing};
+        rstest_addAssertion(&rec, false);
+    }
+}
+
+/// Compare the test case durations with the baseline of the test suite.
+/// Updates regressed of every result record and the regressionCount of the report.
+static void compareBaseline(void)
+{
+    const TestBaseline_t *baseline = k_info.testSuite->baseline;
+    k_info.report.regressionCount  = 0U;
+
+    for (size_t idx = 0U; idx < k_info.report.caseResults.count; idx++)
+    {
+        TestCaseResult_t *result = &(k_info.report.caseResults.records[idx]);
+        result->regressed        = false;
+        if ((baseline == NULL) || (result->durationRuns == 0U) || (result->durationRuns < baseline->noise.minRuns))
+        {
+            continue;
+        }
+
+        for (size_t entry = 0U; entry < baseline->count; entry++)
+        {
+            const TestBaselineEntry_t *base = &(baseline->entries[entry]);
+            if ((result->name != NULL) && (strcmp(base->name, result->name) == 0))
+            {
+                const uint64_t relative = (base->duration / 1000U) * baseline->noise.relativePermille +
+                                          ((base->duration % 1000U) * baseline->noise.relativePermille) / 1000U;
+                const uint64_t allowed  = (relative > baseline->noise.minDelta) ? relative : baseline->noise.minDelta;
+                result->regressed       = (result->duration > (base->duration + allowed));
+                break;
+            }
+        }
+        k_info.report.regressionCount += result->regressed ? 1U : 0U;
+    }
+}
+
+/// Record a trace event of the current test case.
+/// @param[in] kind kind of event
+/// @param[in] begin true for a begin event, false for the end event
+static void traceCase(TestTraceKind_t kind, bool begin)
+{
+    rstest_traceEvent(kind, begin, (uint32_t)indexOf(k_info.current), k_info.current->name, k_info.worker);
+}
+
+/// The body of the current test case starts executing.
+static void bodyBegin(void)
+{
+    traceCase(TestTraceKind_Body, true);
+    k_info.bodyStart = readClock();
+#if defined(RSTEST_PERF_COUNTERS)
+    rstest_perfResume();
+#endif
+}
+
+/// The body of the current test case completed.
+static void bodyEnd(void)
+{
+#if defined(RSTEST_PERF_COUNTERS)
+    rstest_perfPause();
+#endif
+    k_info.bodyTicks += readClock() - k_info.bodyStart;
+    traceCase(TestTraceKind_Body, false);
+}
+
+/// Hash of the test suite and test case names - identifies the test suite of a checkpoint.
+/// @returns the hash
+static uint32_t suiteHash(void)
+{
+    uint32_t hash = rstest_checkpointHash(0U, k_info.testSuite->name);
+    for (size_t idx = 0U; idx < k_info.testSuite->count; idx++)
+    {
+        hash = rstest_checkpointHash(hash, k_info.testSuite->testCases[idx].name);
+    }
+    return hash;
+}
+
+/// Write a checkpoint of the run (when a checkpoint store is set).
+/// @param[in] complete true when the run completed - nothing to resume
+static void checkpoint(bool complete)
+{
+    if (!rstest_checkpointEnabled() || (k_info.testSuite->count > RSTEST_CHECKPOINT_MAX_CASES))
+    {
+        return;
+    }
+    TestCheckpoint_t record;
+    (void)memset(&record, 0, sizeof(record));
+    record.suiteHash  = k_info.suiteHash;
+    record.caseCount  = (uint32_t)k_info.testSuite->count;
+    record.complete   = complete ? 1U : 0U;
+    record.base       = k_info.base;
+    record.passAssert = rstest_assertPassCount;
+    for (size_t idx = 0U; idx < k_info.testSuite->count; idx++)
+    {
+        record.states[idx] = (uint8_t)k_info.testSuite->testCases[idx].state;
+    }
+    rstest_checkpointSave(&record);
+}
+
+/// Record coverage for the current test case (RSTEST_COVERAGE_MAP).
+/// @param[in] begin true when the test case starts executing - its previous coverage is cleared
+static void coverageResume(bool begin)
+{
+#if defined(RSTEST_COVERAGE_MAP)
+    if (begin)
+    {
+        rstest_coverageBegin(indexOf(k_info.current));
+    }
+    else
+    {
+        rstest_coverageResume(indexOf(k_info.current));
+    }
+#else
+    (void)begin;
+#endif
+}
+
+/// Stop recording coverage (RSTEST_COVERAGE_MAP).
+static void coveragePause(void)
+{
+#if defined(RSTEST_COVERAGE_MAP)
+    rstest_coveragePause();
+#endif
+}
+
+/// Execute the fixture startup callback of the test suite (if defined).
+static void fixtureStartup(void)
+{
+    TestSuiteFixtureStartupCb_t suiteStartupCb = k_info.testSuite->suiteStartupCb;
+    k_info.fixture        = (suiteStartupCb != NULL) ? suiteStartupCb(k_info.testSuite->suiteStartupCbUser) : NULL;
+    k_info.fixtureStarted = true;
+}
+
+/// Execute the fixture teardown callback of the test suite (if defined).
+static void fixtureTeardown(void)
+{
+    TestSuiteFixtureTeardownCb_t suiteTeardownCb = k_info.testSuite->suiteTeardownCb;
+    if (suiteTeardownCb != NULL)
+    {
+        suiteTeardownCb(k_info.testSuite->suiteTeardownCbUser, k_info.fixture);
+    }
+    k_info.fixture        = NULL;
+    k_info.fixtureStarted = false;
+}
+
+/// Is the test suite in snapshot mode - startup once then restore the snapshot regions?
+/// @retval true when snapshot regions are defined
+/// @retval false otherwise
+static bool snapshotMode(void) { return (k_info.testSuite->snapshotCount != 0U); }
+
+/// Execute the startup callback of the test suite (if defined), then capture the
+/// snapshot regions in snapshot mode.
+static void startupCapture(void)
+{
+    TestSuiteStartupCb_t startupCb = k_info.testSuite->startupCb;
+    if (startupCb != NULL)
+    {
+        startupCb(k_info.testSuite->startupCbUser);
+    }
+
+    if (snapshotMode())
+    {
+        const TestSnapshotRegion_t *regions = k_info.testSuite->snapshotRegions;
+        assert(regions != NULL);
+        for (size_t idx = 0U; idx < k_info.testSuite->snapshotCount; idx++)
+        {
+            memcpy(regions[idx].copy, regions[idx].addr, regions[idx].size);
+        }
+        k_info.snapshotTaken = true;
+    }
+}
+
+/// Execute the startup callback once in snapshot mode, before the first test case
+/// executes - it is not measured as part of it (heap, stack, execution time).
+static void snapshotStartup(void)
+{
+    if (snapshotMode() && !k_info.snapshotTaken)
+    {
+        rstest_traceEvent(TestTraceKind_Startup, true, RSTEST_TRACE_NO_CASE, k_info.testSuite->name, 0U);
+        startupCapture();
+        rstest_traceEvent(TestTraceKind_Startup, false, RSTEST_TRACE_NO_CASE, k_info.testSuite->name, 0U);
+    }
+}
+
+/// Execute the startup callback of the test suite (if defined).
+/// In snapshot mode the regions captured by the single startup are restored
+/// for every test case instead.
+static void startup(void)
+{
+    traceCase(TestTraceKind_Startup, true);
+    if (k_info.snapshotTaken)
+    {
+        const TestSnapshotRegion_t *regions = k_info.testSuite->snapshotRegions;
+        for (size_t idx = 0U; idx < k_info.testSuite->snapshotCount; idx++)
+        {
+            memcpy(regions[idx].addr, regions[idx].copy, regions[idx].size);
+        }
+    }
+    else
+    {
+        startupCapture(); // Test case executed outside of rstest_run() (rstest_executeParam()).
+    }
+    traceCase(TestTraceKind_Startup, false);
+}
+
+/// Execute the teardown callback of the test suite (if defined).
+/// In snapshot mode it is executed once at the end of rstest_run() instead.
+static void teardown(void)
+{
+    TestSuiteTeardownCb_t teardownCb = k_info.testSuite->teardownCb;
+    traceCase(TestTraceKind_Teardown, true);
+    if ((teardownCb != NULL) && !snapshotMode())
+    {
+        teardownCb(k_info.testSuite->teardownCbUser);
+    }
+    traceCase(TestTraceKind_Teardown, false);
+}
+
+/// Execute the teardown callback once for the startup of snapshot mode.
+static void snapshotTeardown(void)
+{
+    TestSuiteTeardownCb_t teardownCb = k_info.testSuite->teardownCb;
+    if ((teardownCb != NULL) && k_info.snapshotTaken)
+    {
+        teardownCb(k_info.testSuite->teardownCbUser);
+    }
+    k_info.snapshotTaken = false;
+}
+
+/// Execute a parameterized test case.
+/// Every parameter is executed as its own pass/fail and the test case only
+/// passes when all parameters pass. The startup and teardown callbacks are
+/// executed once per batch of paramBatch parameters.
+/// @param[in,out] result result record of the test case (may be NULL)
+static void executeParamTestCase(TestCaseResult_t *result)
+{
+    TestCase_t    *testCase = k_info.current;
+    const uint8_t *params   = (const uint8_t *)testCase->params;
+    const size_t   batch    = (k_info.testSuite->paramBatch == 0U) ? 1U : k_info.testSuite->paramBatch;
+    uint32_t       failures = 0U;
+    uint32_t       first    = RSTEST_NO_PARAM;
+
+    for (size_t idx = 0U; idx < testCase->paramCount;)
+    {
+        startup();
+        const size_t last = ((testCase->paramCount - idx) < batch) ? testCase->paramCount : (idx + batch);
+        bodyBegin();
+        for (; idx < last; idx++)
+        {
+            k_info.param    = (uint32_t)idx;
+            testCase->state = TestCaseState_Executing;
+            testCase->paramFunc(params + (idx * testCase->paramSize), idx);
+            if (testCase->state != TestCaseState_Pass)
+            {
+                failures++;
+                first = (first == RSTEST_NO_PARAM) ? k_info.param : first;
+            }
+        }
+        bodyEnd();
+        k_info.param = RSTEST_NO_PARAM;
+        teardown();
+    }
+
+    // An empty parameter table never passes - same as a test case that never ends.
+    testCase->state = ((failures == 0U) && (testCase->paramCount != 0U)) ? TestCaseState_Pass : TestCaseState_Fail;
+    if (result != NULL)
+    {
+        result->paramCount     = (uint32_t)testCase->paramCount;
+        result->paramFailCount = failures;
+        result->paramFirstFail = first;
+    }
+}
+
+/// Count the current executed test case in the report.
+static void countExecuted(void)
+{
+    k_info.report.executedCount++;
+    if (k_info.current->state == TestCaseState_Pass)
+    {
+        k_info.report.passCount++;
+    }
+    else
+    {
+        k_info.report.failCount++;
+    }
+}
+
+/// Complete the current executed test case - update its result and the report.
+/// @param[in,out] result result record of the test case (may be NULL)
+static void completeTestCase(TestCaseResult_t *result)
+{
+    // Returned without END_TESTCASE_PASS() - a failure, the same as rstest_executeParam().
+    if (k_info.current->state != TestCaseState_Pass)
+    {
+        k_info.current->state = TestCaseState_Fail;
+    }
+    updateResult(result);
+    rstest_statusCase(indexOf(k_info.current), k_info.current->name, TestCaseState_Executing, k_info.current->state);
+    rstest_logEnd((uint32_t)indexOf(k_info.current), k_info.current->state != TestCaseState_Pass);
+    countExecuted();
+    checkpoint(false);
+}
+
+/// Block a test case whose prerequisite did not pass - it is not executed.
+/// @param[in,out] testCase test case of the test suite
+static void blockTestCase(TestCase_t *testCase)
+{
+    k_info.current        = testCase;
+    k_info.current->state = TestCaseState_Blocked;
+    updateResult(resultOf(testCase));
+    rstest_statusCase(indexOf(testCase), testCase->name, TestCaseState_Idle, TestCaseState_Blocked);
+    k_info.report.blockedCount++;
+}
+
+/// Defer a test case of a time budgeted run - it is not executed.
+/// @param[in,out] testCase test case of the test suite
+static void deferTestCase(TestCase_t *testCase)
+{
+    k_info.current        = testCase;
+    k_info.current->state = TestCaseState_Deferred;
+    updateResult(resultOf(testCase));
+    rstest_statusCase(indexOf(testCase), testCase->name, TestCaseState_Idle, TestCaseState_Deferred);
+    k_info.report.deferredCount++;
+}
+
+/// Does a test case fit in the time left of a time budgeted run?
+/// @param[in] testCase test case of the test suite
+/// @retval true when not a time budgeted run, or its expected duration fits
+static bool budgetLeft(const TestCase_t *testCase)
+{
+    if (!k_info.budgeted)
+    {
+        return true;
+    }
+    const uint64_t elapsed = readClock() - k_info.budgetStart;
+    return (elapsed < k_info.budgetLimit) && (k_budgetExpected[indexOf(testCase)] <= (k_info.budgetLimit - elapsed));
+}
+
+/// Test case at a position of the execution order.
+/// @param[in] pos position, less than the count of test cases
+/// @returns the test case, in priority order for a time budgeted run
+static TestCase_t *caseAt(size_t pos)
+{
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#elif defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-qual"
+#endif
+    return (TestCase_t *)&(k_info.testSuite->testCases[k_info.budgeted ? k_budgetOrder[pos] : pos]);
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+}
+
+/// Account for a test case restored by rstest_resume() - it is not executed again.
+/// A test case that was executing when the run was interrupted fails.
+/// @retval true when restored
+/// @retval false when the test case is still to execute
+static bool resumeTestCase(void)
 {
+    const TestCaseState_t state = k_info.current->state;
+    if (state == TestCaseState_Blocked)
+    {
+        k_info.current->state = TestCaseState_Idle;
+        blockTestCase(k_info.current);
+        return true;
+    }
+    if ((state != TestCaseState_Pass) && (state != TestCaseState_Fail) && (state != TestCaseState_Executing))
+    {
+        return false;
+    }
+
+    rstest_statusCase(indexOf(k_info.current), k_info.current->name, TestCaseState_Idle, TestCaseState_Executing);
+    if (state == TestCaseState_Executing)
+    {
+        // Interrupted (reset) while executing.
+        rstest_addAssertion(ASSERT_RECORD(), false);
+    }
+    updateResult(currentResult());
+    rstest_statusCase(indexOf(k_info.current), k_info.current->name, TestCaseState_Executing, k_info.current->state);
+    countExecuted();
+    return true;
+}
+
+/// Execute the startup callback, the body and the teardown callback of the current test case (not async).
+/// @param[in,out] arg result record of the test case (may be NULL)
+static void executeBody(void *arg)
+{
+    if (k_info.current->paramFunc != NULL)
+    {
+        executeParamTestCase((TestCaseResult_t *)arg);
+    }
+    else
+    {
+        startup();
+        bodyBegin();
+        k_info.current->func();
+        bodyEnd();
+        teardown();
+    }
+}
+
+/// Execute the current test case (not async).
+static void executeTestCase(void)
+{
+    TestCaseResult_t *result = currentResult();
+
+    // Execute - and func() changes the state but if still in executing and
+    // hasn't changed to Pass, then this is considered a fail.
+    k_info.current->state = TestCaseState_Executing;
+    rstest_statusCase(indexOf(k_info.current), k_info.current->name, TestCaseState_Idle, TestCaseState_Executing);
+    checkpoint(false);
+    rstest_logBegin();
+    rstest_timeReset();
+    if (result != NULL)
+    {
+        result->dataSeed = 0U;
+    }
+    k_info.bodyTicks     = 0U;
+    const uint64_t start = readClock();
+#if defined(RSTEST_HEAP_TRACKING)
+    rstest_heapBegin();
+#endif
+#if defined(RSTEST_PERF_COUNTERS)
+    rstest_perfBegin();
+#endif
+    coverageResume(true);
+#if defined(RSTEST_STACK_USAGE)
+    rstest_stackRun(&executeBody, result, (result != NULL) ? &(result->stack) : NULL, k_info.testSuite->stack);
+#else
+    executeBody(result);
+#endif
+    coveragePause();
+
+#if defined(RSTEST_HEAP_TRACKING)
+    rstest_heapEnd((result != NULL) ? &(result->heap) : NULL, k_info.testSuite->heapLimits);
+#endif
+#if defined(RSTEST_PERF_COUNTERS)
+    rstest_perfEnd((result != NULL) ? &(result->perf) : NULL, k_info.testSuite->perfLimits);
+#endif
+    checkDeadline();
+    recordDuration(result, start);
+    completeTestCase(result);
+}
+
+/// Start the next enabled async test case in a free slot.
+/// Async test cases whose prerequisites did not pass are blocked on the way.
+/// @param[in,out] slot free slot to start the test case in
+/// @param[in,out] next next test case to consider, advanced past the started one
+/// @param[in] end end of the test cases
+/// @param[in] shared other async test cases are executing
+static void startAsyncTestCase(AsyncSlot_t *slot, TestCase_t **next, const TestCase_t *end, bool shared)
+{
+    for (; *next < end; (*next)++)
+    {
+        if (((*next)->asyncFunc == NULL) || ((*next)->state != TestCaseState_Idle))
+        {
+            continue;
+        }
+        if (dependsState(*next) != TestCaseState_Pass)
+        {
+            // Every other test case completed - a prerequisite still to execute never will.
+            blockTestCase(*next);
+            continue;
+        }
+        if (!budgetLeft(*next))
+        {
+            continue;
+        }
+
+        slot->testCase     = *next;
+        slot->async.resume = 0U;
+        slot->async.file   = NULL;
+        slot->start        = readClock();
+        (*next)++;
+
+        k_info.current        = slot->testCase;
+        k_info.current->state = TestCaseState_Executing;
+        rstest_statusCase(indexOf(k_info.current), k_info.current->name, TestCaseState_Idle, TestCaseState_Executing);
+        checkpoint(false);
+        TestCaseResult_t *result = currentResult();
+        if (result != NULL)
+        {
+            result->dataSeed = 0U;
+        }
+        // The virtual time is shared with the other executing test cases.
+        if (!shared)
+        {
+            rstest_timeReset();
+        }
+        coverageResume(true);
+        // Restoring the snapshot would change the state of the other executing test cases.
+        if (!shared || !k_info.snapshotTaken)
+        {
+            startup();
+        }
+        coveragePause();
+        return;
+    }
+}
+
+/// Execute all async test cases.
+/// Up to RSTEST_MAX_ASYNC_CASES are resumed in turn until each completes. When
+/// every executing test case is waiting the asyncPollCb is executed, if it
+/// returns false (or without one, no test case made progress) the waiting test
+/// cases fail at the RSTEST_AWAIT() they are waiting on.
+/// @param[in] begin first test case of the suite
+/// @param[in] end end of the test cases
+static void executeAsyncTestCases(TestCase_t *begin, const TestCase_t *end)
+{
+    AsyncSlot_t slots[RSTEST_MAX_ASYNC_CASES] = {{0}};
+    TestCase_t *next                          = begin;
+    size_t      active                        = 0U;
+
+    rstest_logBegin();
+    do
+    {
+        // Fill the free slots.
+        for (size_t idx = 0U; idx < RSTEST_MAX_ASYNC_CASES; idx++)
+        {
+            if (slots[idx].testCase == NULL)
+            {
+                k_info.worker = (uint16_t)(idx + 1U);
+                startAsyncTestCase(&slots[idx], &next, end, active != 0U);
+                active += (slots[idx].testCase != NULL) ? 1U : 0U;
+            }
+        }
+
+        // Resume every executing test case once.
+        bool progress = false;
+        active        = 0U;
+        for (size_t idx = 0U; idx < RSTEST_MAX_ASYNC_CASES; idx++)
+        {
+            AsyncSlot_t *slot = &slots[idx];
+            if (slot->testCase == NULL)
+            {
+                continue;
+            }
+            const uint32_t resume = slot->async.resume;
+            k_info.current        = slot->testCase;
+            k_info.worker         = (uint16_t)(idx + 1U);
+            coverageResume(false);
+            traceCase(TestTraceKind_Body, true);
+            k_info.current->asyncFunc(&(slot->async));
+            traceCase(TestTraceKind_Body, false);
+            if (slot->async.resume == 0U)
+            {
+                teardown();
+                coveragePause();
+                recordDuration(resultOf(slot->testCase), slot->start);
+                completeTestCase(resultOf(slot->testCase));
+                slot->testCase = NULL;
+                progress       = true;
+            }
+            else
+            {
+                coveragePause();
+                progress = progress || (slot->async.resume != resume);
+                active++;
+            }
+        }
+
+        if (active == 0U)
+        {
+            continue;
+        }
+        TestAsyncPollCb_t pollCb = k_info.testSuite->asyncPollCb;
+        if ((pollCb != NULL) ? pollCb(k_info.testSuite->asyncPollCbUser) : progress)
+        {
+            continue;
+        }
+
+        // Nothing more can happen - the waiting test cases never complete.
+        for (size_t idx = 0U; idx < RSTEST_MAX_ASYNC_CASES; idx++)
+        {
+            AsyncSlot_t *slot = &slots[idx];
+            if (slot->testCase != NULL)
+            {
+                const AssertRecord_t rec = {slot->async.file, slot->async.resume, RSTEST_NO_PARAM,
+                                            AssertKind_Condition};
+                k_info.current           = slot->testCase;
+                k_info.worker            = (uint16_t)(idx + 1U);
+                rstest_addAssertion(&rec, false);
+                coverageResume(false);
+                teardown();
+                coveragePause();
+                recordDuration(resultOf(slot->testCase), slot->start);
+                completeTestCase(resultOf(slot->testCase));
+                slot->testCase = NULL;
+            }
+        }
+        active = 0U;
+    } while ((active != 0U) || (next < end));
+    k_info.worker = 0U;
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_addAssertion(const AssertRecord_t *rec, bool cond)
+{
+    // Identify the parameter the assertion belongs to.
+    AssertRecord_t record = *rec;
+    record.param          = k_info.param;
+    rec                   = &record;
+
+    ASSERT_LOCK();
     AssertRecordList_t *recordList = (cond) ? &(k_info.report.passAsserts) : &(k_info.report.failAsserts);
     if (recordList->count < MAX_NUM_ASSERTIONS)
     {
-        recordList->count++;
         recordList->records[recordList->count] = *rec;
+        recordList->count++;
     }
 
     assert(k_info.state == TestSuiteState_Running);
@@ -88,26 +922,127 @@ static void addAssertion(const AssertRecord_t *rec, bool cond)
     {
         assert(k_info.current != NULL);
         k_info.current->state = TestCaseState_Fail;
+        rstest_statusFailure(indexOf(k_info.current), rec);
+    }
+    ASSERT_UNLOCK();
 
+    // Callbacks outside of the lock - they may assert, allocate or block.
+    if (!cond)
+    {
         TestFailureCb_t failure = k_info.testSuite->failureCb;
         if (failure != NULL)
         {
+            traceCase(TestTraceKind_Failure, true);
             failure(rec, k_info.testSuite->failureCbUser);
+            traceCase(TestTraceKind_Failure, false);
+        }
+
+        if (k_info.abortOnFailure)
+        {
+            abort();
         }
     }
 }
 
+void rstest_setAbortOnFailure(bool enable) { k_info.abortOnFailure = enable; }
+
+uint32_t rstest_currentCase(void)
+{
+    if ((k_info.state != TestSuiteState_Running) || (k_info.current == NULL))
+    {
+        return UINT32_MAX;
+    }
+    return (uint32_t)indexOf(k_info.current);
+}
+
+uint64_t rstest_readClock(void) { return (k_info.testSuite != NULL) ? readClock() : 0U; }
+
+void rstest_dataUsed(uint64_t seed)
+{
+    TestCaseResult_t *result = (rstest_currentCase() != UINT32_MAX) ? currentResult() : NULL;
+    if (result != NULL)
+    {
+        result->dataSeed = seed;
+    }
+}
+
+TestCaseState_t rstest_executeParam(size_t caseIndex, const void *param)
+{
+    if ((k_info.state != TestSuiteState_Ready) && (k_info.state != TestSuiteState_Complete))
+    {
+        return TestCaseState_Disabled;
+    }
+    assert(caseIndex < k_info.testSuite->count);
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#elif defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-qual"
+#endif
+    TestCase_t *testCase = (TestCase_t *)&(k_info.testSuite->testCases[caseIndex]);
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+    if ((testCase->paramFunc == NULL) || (testCase->state == TestCaseState_Disabled))
+    {
+        return TestCaseState_Disabled;
+    }
+
+    const TestSuiteState_t prevState = k_info.state;
+    k_info.state                     = TestSuiteState_Running;
+    k_info.current                   = testCase;
+
+    // The fixture is shared by every executed parameter until re-initialized.
+    if (!k_info.fixtureStarted)
+    {
+        fixtureStartup();
+    }
+
+    rstest_timeReset();
+    startup();
+    k_info.param    = 0U;
+    testCase->state = TestCaseState_Executing;
+    testCase->paramFunc(param, 0U);
+    k_info.param = RSTEST_NO_PARAM;
+    teardown();
+
+    // Same as a test case - if it never ended as Pass it is a failure.
+    if (testCase->state != TestCaseState_Pass)
+    {
+        testCase->state = TestCaseState_Fail;
+    }
+    k_info.state = prevState;
+    return testCase->state;
+}
+
+void rstest_release(void)
+{
+    k_info.testSuite = NULL;
+    k_info.current   = NULL;
+    k_info.fixture   = NULL;
+    k_info.report    = (TestReport_t){0};
+    k_info.state     = TestSuiteState_NotReady;
+}
+
 // ------------------------------------------------------------------
 // Report API
 
+void *rstest_fixture(void) { return k_info.fixture; }
+
 bool rstest_testSuiteCompleted(void) { return (k_info.state == TestSuiteState_Complete); }
 
 bool rstest_testSuitePassed(void)
 {
     // Note some of these are redundant but better to confirm state of report is correct
     return (rstest_testSuiteCompleted() && (k_info.report.testCount != 0) &&
-            (k_info.report.testCount == (k_info.report.disabledCount + k_info.report.executedCount)) &&
-            (k_info.report.executedCount == k_info.report.passCount) && (k_info.report.failCount == 0));
+            (k_info.report.testCount ==
+             (k_info.report.disabledCount + k_info.report.deferredCount + k_info.report.executedCount)) &&
+            (k_info.report.executedCount == k_info.report.passCount) && (k_info.report.failCount == 0) &&
+            (k_info.report.regressionCount == 0));
 }
 
 const TestReport_t *rstest_getReport(void)
@@ -139,7 +1074,7 @@ TestCaseState_t rstest_changeTestCaseState(const AssertRecord_t *rec, TestCaseSt
         if (state != TestCaseState_Executing)
         {
             // Invalid state transition - use of Macros is incorrect.
-            addAssertion(rec, false);
+            rstest_addAssertion(rec, false);
             return TestCaseState_Disabled;
         }
         break;
@@ -155,7 +1090,7 @@ TestCaseState_t rstest_changeTestCaseState(const AssertRecord_t *rec, TestCaseSt
         if ((state == TestCaseState_Idle) || (state == TestCaseState_Disabled))
         {
             // Invalid state transition - not using Macros
-            addAssertion(rec, false);
+            rstest_addAssertion(rec, false);
             return TestCaseState_Disabled;
         }
         break;
@@ -163,7 +1098,7 @@ TestCaseState_t rstest_changeTestCaseState(const AssertRecord_t *rec, TestCaseSt
     default:
     {
         // Unknown state - not using Macros
-        addAssertion(rec, false);
+        rstest_addAssertion(rec, false);
         return TestCaseState_Disabled;
     }
     }
@@ -172,13 +1107,13 @@ TestCaseState_t rstest_changeTestCaseState(const AssertRecord_t *rec, TestCaseSt
     // When Ending - always add an assertion of passing or failing.
     if (state == TestCaseState_Fail)
     {
-        addAssertion(rec, false);
+        rstest_addAssertion(rec, false);
         k_info.current->state = state;
     }
     // Can only pass if current state is executing.
     else if ((state == TestCaseState_Pass) && (k_info.current->state == TestCaseState_Executing))
     {
-        addAssertion(rec, true);
+        rstest_addAssertion(rec, true);
         k_info.current->state = state;
     }
     return state;
@@ -196,11 +1131,59 @@ TestCaseState_t rstest_assertTrue(const AssertRecord_t *rec, bool cond)
         assert(k_info.current != NULL);
         return k_info.current->state;
     }
-    addAssertion(rec, cond);
+    rstest_addAssertion(rec, cond);
     return k_info.current->state;
 }
 
-bool rstest_init(const TestSuite_t *testSuite)
+bool rstest_assertWithin(const AssertRecord_t *rec, uint64_t start, uint64_t budget)
+{
+    if ((k_info.state != TestSuiteState_Running) || (k_info.testSuite->clockCb == NULL))
+    {
+        return true;
+    }
+    const uint64_t elapsed = readClock() - start;
+    recordTiming(rec->file, rec->line, elapsed, budget);
+    if (elapsed > budget)
+    {
+        rstest_addAssertion(rec, false);
+        return false;
+    }
+    RSTEST_ASSERT_PASS();
+    return true;
+}
+
+RSTEST_COLD void rstest_assertFail(const char *file, uint32_t line)
+{
+    const char          *name = strrchr(file, PATH_DELIMITER);
+    const AssertRecord_t rec  = {(name != NULL) ? (name + 1) : file, line, RSTEST_NO_PARAM, AssertKind_Condition};
+    (void)rstest_assertTrue(&rec, false);
+}
+
+/// Are the prerequisites of a test case valid?
+/// Every prerequisite must be another test case of the suite that is not async -
+/// async test cases execute last. A dependency cycle is only found when executed.
+/// @param[in] testCase test case of the test suite
+/// @retval true when valid
+/// @retval false otherwise
+static bool validDepends(const TestCase_t *testCase)
+{
+    for (const char *const *name = testCase->depends; (name != NULL) && (*name != NULL); name++)
+    {
+        const TestCase_t *depend = findTestCase(*name);
+        if ((depend == NULL) || (depend == testCase) || (depend->asyncFunc != NULL))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Initialize the rstest with the TestSuite.
+/// @param[in] testSuite the test suite to initalize.
+/// @param[in] validate check the initial state and functions of the test cases
+/// @retval true if initialization worked (correct state and input)
+/// @retval false otherwise
+static bool initTestSuite(const TestSuite_t *testSuite, bool validate)
 {
     k_info.testSuite   = testSuite;
     k_info.report      = (TestReport_t){0}; // Clear out the report
@@ -218,9 +1201,13 @@ bool rstest_init(const TestSuite_t *testSuite)
     const TestCase_t *begin = k_info.testSuite->testCases;
     const TestCase_t *end   = begin + k_info.testSuite->count;
 
-    for (const TestCase_t *current = begin; current < end; current++)
+    for (const TestCase_t *current = begin; validate && (current < end); current++)
     {
-        if ((current->state != TestCaseState_Idle) && (current->state != TestCaseState_Disabled))
+        // Must be a valid initial state and exactly one of a test case, parameterized or async test case.
+        const unsigned funcCount = ((current->func != NULL) ? 1U : 0U) + ((current->paramFunc != NULL) ? 1U : 0U) +
+                                   ((current->asyncFunc != NULL) ? 1U : 0U);
+        if (((current->state != TestCaseState_Idle) && (current->state != TestCaseState_Disabled)) ||
+            (funcCount != 1U) || !validDepends(current))
         {
             k_info.state = TestSuiteState_NotReady;
             return false;
@@ -233,7 +1220,14 @@ bool rstest_init(const TestSuite_t *testSuite)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wcast-qual"
 #endif
-    k_info.current = (TestCase_t *)begin;
+    k_info.current        = (TestCase_t *)begin;
+    k_info.param          = RSTEST_NO_PARAM;
+    k_info.abortOnFailure = false;
+    k_info.fixtureStarted = false;
+    k_info.snapshotTaken  = false;
+    k_info.worker         = 0U;
+    k_info.resumed        = false;
+    k_info.fixture        = NULL;
 #if defined(__GNUC__)
 #pragma GCC diagnostic pop
 #elif defined(__clang__)
@@ -243,6 +1237,10 @@ bool rstest_init(const TestSuite_t *testSuite)
     return true;
 }
 
+bool rstest_init(const TestSuite_t *testSuite) { return initTestSuite(testSuite, true); }
+
+bool rstest_initValidated(const TestSuite_t *testSuite) { return initTestSuite(testSuite, false); }
+
 bool rstest_run(void)
 {
 
@@ -250,11 +1248,34 @@ bool rstest_run(void)
     {
         return false;
     }
+    if (rstest_checkpointEnabled() && (k_info.testSuite->count > RSTEST_CHECKPOINT_MAX_CASES))
+    {
+        return false; // Would not be resumable.
+    }
 
     // Init takes care of clearing the report info.
     // Additive -to account for re-running suite multiple times.
+    k_info.base = (TestCheckpointCounters_t){k_info.report.testCount,     k_info.report.disabledCount,
+                                             k_info.report.executedCount, k_info.report.passCount,
+                                             k_info.report.failCount,     k_info.report.blockedCount,
+                                             k_info.report.deferredCount, k_info.report.passAssertCount};
+    k_info.suiteHash = rstest_checkpointEnabled() ? suiteHash() : 0U;
     k_info.report.testCount += k_info.testSuite->count;
+    k_info.report.caseResults.count = (k_info.testSuite->count < MAX_NUM_TESTCASE_RESULTS)
+                                          ? k_info.testSuite->count
+                                          : MAX_NUM_TESTCASE_RESULTS;
     k_info.state = TestSuiteState_Running;
+    if (!k_info.resumed)
+    {
+        rstest_assertPassCount = 0U; // Otherwise restored by rstest_resume().
+    }
+    rstest_statusBegin(k_info.testSuite->name, k_info.testSuite->count);
+#if defined(RSTEST_COVERAGE_MAP)
+    rstest_coverageStart(k_info.testSuite->count);
+#endif
+    rstest_traceEvent(TestTraceKind_Suite, true, RSTEST_TRACE_NO_CASE, k_info.testSuite->name, 0U);
+    fixtureStartup();
+    snapshotStartup();
     assert(k_info.testSuite->testCases != NULL);
     const TestCase_t *begin = k_info.testSuite->testCases;
     const TestCase_t *end   = begin + k_info.testSuite->count;
@@ -267,40 +1288,145 @@ bool rstest_run(void)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wcast-qual"
 #endif
-    for (k_info.current = (TestCase_t *)begin; k_info.current < end; k_info.current++)
+    for (TestCase_t *testCase = (TestCase_t *)begin; (testCase < end) && !k_info.resumed; testCase++)
     {
-        if (k_info.current->state == TestCaseState_Disabled)
-        {
-            k_info.report.disabledCount++;
-            continue;
-        }
+        testCase->state = (testCase->state == TestCaseState_Disabled) ? TestCaseState_Disabled : TestCaseState_Idle;
+    }
 
-        // Execute - and func() changes the state but if still in executing and
-        // hasn't changed to Pass, then this is considered a fail.
-        k_info.current->state        = TestCaseState_Executing;
-        TestSuiteStartupCb_t startup = k_info.testSuite->startupCb;
-        if (startup != NULL)
+    // Execute in order (priority order when time budgeted) every test case whose
+    // prerequisites completed, until none is left that can execute. Async test
+    // cases are executed together once the other test cases complete.
+    bool progress = true;
+    for (bool first = true; progress; first = false)
+    {
+        progress = false;
+        for (size_t pos = 0U; pos < k_info.testSuite->count; pos++)
         {
-            startup(k_info.testSuite->startupCbUser);
+            k_info.current = caseAt(pos);
+            if (first && (k_info.current->state == TestCaseState_Disabled))
+            {
+                k_info.report.disabledCount++;
+                updateResult(currentResult());
+                rstest_statusCase(indexOf(k_info.current), k_info.current->name, TestCaseState_Idle,
+                                  TestCaseState_Disabled);
+                continue;
+            }
+            if (first && k_info.resumed && resumeTestCase())
+            {
+                continue;
+            }
+            if ((k_info.current->state != TestCaseState_Idle) || (k_info.current->asyncFunc != NULL))
+            {
+                continue;
+            }
+            const TestCaseState_t depends = dependsState(k_info.current);
+            if ((depends == TestCaseState_Pass) && budgetLeft(k_info.current))
+            {
+                executeTestCase();
+                progress = true;
+            }
+            else if (depends == TestCaseState_Blocked)
+            {
+                blockTestCase(k_info.current);
+                progress = true;
+            }
         }
+    }
 
-        k_info.current->func();
-
-        TestSuiteTeardownCb_t teardown = k_info.testSuite->teardownCb;
-        if (teardown != NULL)
+    // Still waiting on a prerequisite - a dependency cycle, never executed. When
+    // time budgeted, left out of the budget (or waiting on a deferred prerequisite).
+    for (TestCase_t *testCase = (TestCase_t *)begin; testCase < end; testCase++)
+    {
+        if ((testCase->state == TestCaseState_Idle) && (testCase->asyncFunc == NULL))
         {
-            teardown(k_info.testSuite->teardownCbUser);
+            if (k_info.budgeted)
+            {
+                deferTestCase(testCase);
+            }
+            else
+            {
+                blockTestCase(testCase);
+            }
         }
-
-        // Update report info
-        k_info.report.executedCount++;
-        if (k_info.current->state == TestCaseState_Pass)
+    }
+    executeAsyncTestCases((TestCase_t *)begin, end);
+    for (TestCase_t *testCase = (TestCase_t *)begin; k_info.budgeted && (testCase < end); testCase++)
+    {
+        if (testCase->state == TestCaseState_Idle)
         {
-            k_info.report.passCount++;
+            deferTestCase(testCase);
         }
-        else
+    }
+    snapshotTeardown();
+    fixtureTeardown();
+    k_info.report.passAssertCount += rstest_assertPassCount;
+    compareBaseline();
+    rstest_traceEvent(TestTraceKind_Suite, false, RSTEST_TRACE_NO_CASE, k_info.testSuite->name, 0U);
+    rstest_statusEnd();
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#elif defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+    checkpoint(true);
+    k_info.resumed = false;
+    k_info.state   = TestSuiteState_Complete;
+    return true;
+}
+
+bool rstest_runBudget(uint64_t limit, const TestHistory_t *history)
+{
+    if ((k_info.state == TestSuiteState_NotReady) || (k_info.testSuite->clockCb == NULL) ||
+        (k_info.testSuite->count > RSTEST_BUDGET_MAX_CASES))
+    {
+        return false;
+    }
+    rstest_budgetOrder(k_info.testSuite, history, k_budgetOrder, k_budgetExpected);
+    k_info.budgetStart = readClock();
+    k_info.budgetLimit = limit;
+    k_info.budgeted    = true;
+    const bool ran     = rstest_run();
+    k_info.budgeted    = false;
+    return ran;
+}
+
+bool rstest_resume(void)
+{
+    TestCheckpoint_t record;
+    if ((k_info.state != TestSuiteState_Ready) || (k_info.testSuite->count > RSTEST_CHECKPOINT_MAX_CASES) ||
+        !rstest_checkpointLoad(&record) || (record.complete != 0U) ||
+        (record.caseCount != k_info.testSuite->count) || (record.suiteHash != suiteHash()))
+    {
+        return false;
+    }
+
+    k_info.report.testCount       = record.base.testCount;
+    k_info.report.disabledCount   = record.base.disabledCount;
+    k_info.report.executedCount   = record.base.executedCount;
+    k_info.report.passCount       = record.base.passCount;
+    k_info.report.failCount       = record.base.failCount;
+    k_info.report.blockedCount    = record.base.blockedCount;
+    k_info.report.deferredCount   = record.base.deferredCount;
+    k_info.report.passAssertCount = record.base.passAssertCount;
+    rstest_assertPassCount        = record.passAssert;
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+#elif defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wcast-qual"
+#endif
+    for (size_t idx = 0U; idx < k_info.testSuite->count; idx++)
+    {
+        TestCase_t           *testCase = (TestCase_t *)&(k_info.testSuite->testCases[idx]);
+        const TestCaseState_t state    = (TestCaseState_t)record.states[idx];
+        if ((testCase->state != TestCaseState_Disabled) &&
+            ((state == TestCaseState_Pass) || (state == TestCaseState_Fail) || (state == TestCaseState_Blocked) ||
+             (state == TestCaseState_Executing)))
         {
-            k_info.report.failCount++;
+            testCase->state = state;
         }
     }
 #if defined(__GNUC__)
@@ -308,7 +1434,6 @@ bool rstest_run(void)
 #elif defined(__clang__)
 #pragma clang diagnostic pop
 #endif
-
-    k_info.state = TestSuiteState_Complete;
+    k_info.resumed = true;
     return true;
 }
@@ -0,0 +1,141 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork performance baseline files and clock
+/// (host only).
+//
+
+#define _POSIX_C_SOURCE 200809L // clock_gettime
+
+#include "rstest/rstest_baseline.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/// Maximum length of a baseline file line.
+#define BASELINE_LINE_SIZE (RSTEST_BASELINE_NAME_SIZE + 32)
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Parse a baseline file line into the next entry.
+/// @param[in,out] file baseline being loaded
+/// @param[in] line line of the baseline file
+/// @retval true when parsed (or an empty / comment line)
+/// @retval false when malformed or too many entries
+static bool parseLine(TestBaselineFile_t *file, const char *line)
+{
+    while (isspace((unsigned char)*line) != 0)
+    {
+        line++;
+    }
+    if ((*line == '\0') || (*line == '#'))
+    {
+        return true;
+    }
+    if (file->baseline.count >= RSTEST_BASELINE_MAX_ENTRIES)
+    {
+        return false;
+    }
+
+    char  *name = file->names[file->baseline.count];
+    size_t len  = 0U;
+    for (; (line[len] != '\0') && (isspace((unsigned char)line[len]) == 0); len++)
+    {
+        if (len >= (RSTEST_BASELINE_NAME_SIZE - 1U))
+        {
+            return false;
+        }
+        name[len] = line[len];
+    }
+    name[len] = '\0';
+
+    char                    *end      = NULL;
+    const unsigned long long duration = strtoull(&(line[len]), &end, 10);
+    if ((end == &(line[len])) || ((*end != '\0') && (isspace((unsigned char)*end) == 0)))
+    {
+        return false;
+    }
+
+    TestBaselineEntry_t *entry = &(file->entries[file->baseline.count]);
+    entry->name                = name;
+    entry->duration            = (uint64_t)duration;
+    file->baseline.count++;
+    return true;
+}
+
+// ------------------------------------------------------------------
+// Host API
+
+bool rstest_baselineLoad(TestBaselineFile_t *file, const char *path)
+{
+    const TestNoiseModel_t noise = RSTEST_NOISE_MODEL_DEFAULT;
+    file->baseline.entries       = file->entries;
+    file->baseline.count         = 0U;
+    file->baseline.noise         = noise;
+
+    FILE *stream = fopen(path, "r");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    char line[BASELINE_LINE_SIZE];
+    bool ok = true;
+    while (ok && (fgets(line, (int)sizeof(line), stream) != NULL))
+    {
+        ok = parseLine(file, line);
+    }
+    ok = ok && (ferror(stream) == 0);
+    (void)fclose(stream);
+    return ok;
+}
+
+bool rstest_baselineSave(const TestReport_t *report, const char *path)
+{
+    FILE *stream = fopen(path, "w");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    bool ok = (fprintf(stream, "# rstest baseline: %s\n", (report->name != NULL) ? report->name : "") > 0);
+    for (size_t idx = 0U; ok && (idx < report->caseResults.count); idx++)
+    {
+        const TestCaseResult_t *result = &(report->caseResults.records[idx]);
+        if ((result->name != NULL) && (result->durationRuns != 0U))
+        {
+            ok = (fprintf(stream, "%s %llu\n", result->name, (unsigned long long)result->duration) > 0);
+        }
+    }
+    ok = (fclose(stream) == 0) && ok;
+    return ok;
+}
+
+uint64_t rstest_hostClockNs(void *user)
+{
+    (void)user;
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
@@ -0,0 +1,184 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork paired A/B benchmark.
+//
+
+#include "rstest/rstest_bench.h"
+#include "rstest_internal.h"
+
+#include <stdlib.h>
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Seed of the randomized order when the benchmark has none.
+#define BENCH_DEFAULT_SEED (0x9E3779B9U)
+
+/// Ratio of equal durations.
+#define BENCH_PERMILLE (1000U)
+
+/// z of the two sided 95% confidence interval in permille.
+#define BENCH_Z95_PERMILLE (1960U)
+
+/// Scale of the standard error - keeps its fraction through the integer square root.
+#define BENCH_SE_SCALE (1000000U)
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Next value of the randomized order (xorshift32).
+/// @param[in,out] state state of the generator, never 0
+/// @returns the value
+static uint32_t benchRandom(uint32_t *state)
+{
+    uint32_t value = *state;
+    value ^= value << 13U;
+    value ^= value >> 17U;
+    value ^= value << 5U;
+    *state = value;
+    return value;
+}
+
+/// Measure an implementation.
+/// @param[in] func implementation
+/// @param[in] user user pointer of the implementation
+/// @param[in] iterations calls of the implementation
+/// @returns duration of the calls in clock ticks
+static uint64_t benchMeasure(TestBenchFunc_t func, void *user, uint32_t iterations)
+{
+    const uint64_t start = rstest_readClock();
+    for (uint32_t idx = 0U; idx < iterations; idx++)
+    {
+        func(user);
+    }
+    return rstest_readClock() - start;
+}
+
+/// Integer square root.
+/// @param[in] value value
+/// @returns the largest root whose square is not above value
+static uint64_t benchSqrt(uint64_t value)
+{
+    uint64_t root = 0U;
+    uint64_t bit  = (uint64_t)1U << 62U;
+    while (bit > value)
+    {
+        bit >>= 2U;
+    }
+    while (bit != 0U)
+    {
+        if (value >= (root + bit))
+        {
+            value -= root + bit;
+            root = (root >> 1U) + bit;
+        }
+        else
+        {
+            root >>= 1U;
+        }
+        bit >>= 2U;
+    }
+    return root;
+}
+
+/// Saturate a ratio to the result.
+/// @param[in] value ratio in permille
+/// @returns the ratio, UINT32_MAX when beyond
+static uint32_t benchSaturate(uint64_t value) { return (value < UINT32_MAX) ? (uint32_t)value : UINT32_MAX; }
+
+// ------------------------------------------------------------------
+// Benchmark API
+
+void rstest_benchAB(const void *param, size_t index)
+{
+    (void)index;
+    const TestBenchAB_t *bench  = (const TestBenchAB_t *)param;
+    TestBenchResult_t    result = {0U, 0U, 0U, 0U};
+    START_TESTCASE();
+
+    const uint32_t iterations = (bench->iterations == 0U) ? 1U : bench->iterations;
+    uint32_t       state      = (bench->seed == 0U) ? BENCH_DEFAULT_SEED : bench->seed;
+    uint64_t       sum        = 0U;
+    uint64_t       sumSquares = 0U;
+
+    const bool valid = (bench->oldFunc != NULL) && (bench->newFunc != NULL);
+    ASSERT_TRUE(valid);
+
+    // Warm up (caches, branch predictors, lazy initialization) - not measured.
+    if (valid)
+    {
+        (void)benchMeasure(bench->oldFunc, bench->user, iterations);
+        (void)benchMeasure(bench->newFunc, bench->user, iterations);
+    }
+
+    for (uint32_t pair = 0U; valid && (pair < bench->pairs); pair++)
+    {
+        uint64_t oldTicks = 0U;
+        uint64_t newTicks = 0U;
+        if ((benchRandom(&state) & 1U) != 0U)
+        {
+            oldTicks = benchMeasure(bench->oldFunc, bench->user, iterations);
+            newTicks = benchMeasure(bench->newFunc, bench->user, iterations);
+        }
+        else
+        {
+            newTicks = benchMeasure(bench->newFunc, bench->user, iterations);
+            oldTicks = benchMeasure(bench->oldFunc, bench->user, iterations);
+        }
+        if ((oldTicks == 0U) || (newTicks == 0U))
+        {
+            continue; // Below the resolution of the clock - either side, not to bias the ratio.
+        }
+        const uint64_t ratio = (newTicks * BENCH_PERMILLE) / oldTicks;
+        sum += ratio;
+        sumSquares += ratio * ratio;
+        result.pairs++;
+    }
+
+    if (result.pairs != 0U)
+    {
+        const uint64_t mean     = sum / result.pairs;
+        const uint64_t meanSum  = mean * sum;
+        const uint64_t spread   = (sumSquares > meanSum) ? (sumSquares - meanSum) : 0U;
+        const uint64_t variance = (result.pairs > 1U) ? (spread / (result.pairs - 1U)) : 0U;
+        // Half width of the interval: z * sqrt(variance / pairs).
+        const uint64_t stdError = benchSqrt((variance * BENCH_SE_SCALE) / result.pairs);
+        const uint64_t half     = (BENCH_Z95_PERMILLE * stdError) / BENCH_SE_SCALE;
+        result.ratioPermille    = benchSaturate(mean);
+        result.ciLowPermille    = benchSaturate((mean > half) ? (mean - half) : 0U);
+        result.ciHighPermille   = benchSaturate(mean + half);
+    }
+
+    if (bench->result != NULL)
+    {
+        *(bench->result) = result;
+    }
+
+    // An interval needs two pairs - and one measured is not a comparison.
+    ASSERT_TRUE(result.pairs >= 2U);
+    if (bench->minFasterPermille != RSTEST_BENCH_NO_CHECK)
+    {
+        ASSERT_TRUE((bench->minFasterPermille <= BENCH_PERMILLE) &&
+                    (result.ciHighPermille <= (BENCH_PERMILLE - bench->minFasterPermille)));
+    }
+    END_TESTCASE_PASS();
+}
@@ -0,0 +1,110 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork time budgeted, prioritized run.
+//
+
+#include "rstest/rstest_budget.h"
+#include "rstest_internal.h"
+
+#include <assert.h>
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Priority score of each test case while ordering.
+static uint32_t k_scores[RSTEST_BUDGET_MAX_CASES];
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Find the history entry of a test case.
+/// @param[in] history history (may be NULL)
+/// @param[in] name name of the test case
+/// @returns NULL when not in the history
+static const TestHistoryEntry_t *findEntry(const TestHistory_t *history, const char *name)
+{
+    for (size_t idx = 0U; (history != NULL) && (idx < history->count); idx++)
+    {
+        if ((history->entries[idx].name != NULL) && (strcmp(history->entries[idx].name, name) == 0))
+        {
+            return &(history->entries[idx]);
+        }
+    }
+    return NULL;
+}
+
+/// Does a test case execute before another one?
+/// @param[in] lhs index of the first test case
+/// @param[in] rhs index of the second test case
+/// @param[in] expected duration of each test case
+/// @retval true when lhs has a higher score, or is shorter with the same score
+static bool before(uint32_t lhs, uint32_t rhs, const uint64_t *expected)
+{
+    if (k_scores[lhs] != k_scores[rhs])
+    {
+        return (k_scores[lhs] > k_scores[rhs]);
+    }
+    return (expected[lhs] < expected[rhs]);
+}
+
+// ------------------------------------------------------------------
+// Budget API
+
+uint32_t rstest_budgetScore(const TestHistoryEntry_t *entry)
+{
+    if (entry == NULL)
+    {
+        return RSTEST_BUDGET_SCORE_CHANGED;
+    }
+    uint32_t score = 0U;
+    for (uint32_t run = 0U; run < 8U; run++)
+    {
+        if ((entry->failures & (1UL << run)) != 0U)
+        {
+            score += (1UL << (7U - run));
+        }
+    }
+    return entry->changed ? (score + RSTEST_BUDGET_SCORE_CHANGED) : score;
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_budgetOrder(const TestSuite_t *testSuite, const TestHistory_t *history, uint32_t *order,
+                        uint64_t *expected)
+{
+    assert(testSuite->count <= RSTEST_BUDGET_MAX_CASES);
+    for (uint32_t idx = 0U; idx < (uint32_t)testSuite->count; idx++)
+    {
+        const TestHistoryEntry_t *entry = findEntry(history, testSuite->testCases[idx].name);
+        k_scores[idx]                   = rstest_budgetScore(entry);
+        expected[idx]                   = (entry != NULL) ? entry->duration : 0U;
+
+        // Insertion sort - stable, the test suite order between equals.
+        uint32_t pos = idx;
+        for (; (pos > 0U) && before(idx, order[pos - 1U], expected); pos--)
+        {
+            order[pos] = order[pos - 1U];
+        }
+        order[pos] = idx;
+    }
+}
@@ -0,0 +1,199 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork time budgeted run history files (host only).
+//
+
+#include "rstest/rstest_budget.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// Maximum length of a history file line.
+#define HISTORY_LINE_SIZE (RSTEST_HISTORY_NAME_SIZE + 48)
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Parse a number of a history file line.
+/// @param[in,out] line position in the line, advanced past the number
+/// @param[in] base base of the number
+/// @param[out] value parsed number
+/// @retval true when parsed and followed by a space or the end of the line
+/// @retval false otherwise
+static bool parseNumber(const char **line, int base, unsigned long long *value)
+{
+    char *end = NULL;
+    *value    = strtoull(*line, &end, base);
+    if ((end == *line) || ((*end != '\0') && (isspace((unsigned char)*end) == 0)))
+    {
+        return false;
+    }
+    *line = end;
+    return true;
+}
+
+/// Parse a history file line into the next entry.
+/// @param[in,out] file history being loaded
+/// @param[in] line line of the history file
+/// @retval true when parsed (or an empty / comment line)
+/// @retval false when malformed or too many entries
+static bool parseLine(TestHistoryFile_t *file, const char *line)
+{
+    while (isspace((unsigned char)*line) != 0)
+    {
+        line++;
+    }
+    if ((*line == '\0') || (*line == '#'))
+    {
+        return true;
+    }
+    if (file->history.count >= RSTEST_HISTORY_MAX_ENTRIES)
+    {
+        return false;
+    }
+
+    char  *name = file->names[file->history.count];
+    size_t len  = 0U;
+    for (; (line[len] != '\0') && (isspace((unsigned char)line[len]) == 0); len++)
+    {
+        if (len >= (RSTEST_HISTORY_NAME_SIZE - 1U))
+        {
+            return false;
+        }
+        name[len] = line[len];
+    }
+    name[len] = '\0';
+
+    unsigned long long duration = 0U;
+    unsigned long long failures = 0U;
+    line                        = &(line[len]);
+    if (!parseNumber(&line, 10, &duration) || !parseNumber(&line, 16, &failures))
+    {
+        return false;
+    }
+
+    TestHistoryEntry_t *entry = &(file->entries[file->history.count]);
+    entry->name               = name;
+    entry->duration           = (uint64_t)duration;
+    entry->failures           = (uint32_t)failures;
+    entry->changed            = false;
+    file->history.count++;
+    return true;
+}
+
+/// Find the history entry of a test case.
+/// @param[in] history history (may be NULL)
+/// @param[in] name name of the test case
+/// @returns NULL when not in the history
+static TestHistoryEntry_t *findEntry(const TestHistory_t *history, const char *name)
+{
+    for (size_t idx = 0U; (history != NULL) && (idx < history->count); idx++)
+    {
+        if ((history->entries[idx].name != NULL) && (strcmp(history->entries[idx].name, name) == 0))
+        {
+            return &(history->entries[idx]);
+        }
+    }
+    return NULL;
+}
+
+// ------------------------------------------------------------------
+// Host API
+
+bool rstest_historyLoad(TestHistoryFile_t *file, const char *path)
+{
+    file->history.entries = file->entries;
+    file->history.count   = 0U;
+
+    FILE *stream = fopen(path, "r");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    char line[HISTORY_LINE_SIZE];
+    bool ok = true;
+    while (ok && (fgets(line, (int)sizeof(line), stream) != NULL))
+    {
+        ok = parseLine(file, line);
+    }
+    ok = ok && (ferror(stream) == 0);
+    (void)fclose(stream);
+    return ok;
+}
+
+bool rstest_historySave(const TestReport_t *report, const TestHistory_t *previous, const char *path)
+{
+    FILE *stream = fopen(path, "w");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    bool ok = (fprintf(stream, "# rstest history: %s\n", (report->name != NULL) ? report->name : "") > 0);
+    for (size_t idx = 0U; ok && (idx < report->caseResults.count); idx++)
+    {
+        const TestCaseResult_t *result = &(report->caseResults.records[idx]);
+        if (result->name == NULL)
+        {
+            continue;
+        }
+        const TestHistoryEntry_t *entry    = findEntry(previous, result->name);
+        uint64_t                  duration = (entry != NULL) ? entry->duration : 0U;
+        uint32_t                  failures = (entry != NULL) ? entry->failures : 0U;
+        if ((result->state == TestCaseState_Pass) || (result->state == TestCaseState_Fail))
+        {
+            duration = (result->durationRuns != 0U) ? result->duration : duration;
+            failures = (failures << 1U) | ((result->state == TestCaseState_Fail) ? 1U : 0U);
+        }
+        else if (entry == NULL)
+        {
+            // Never executed - nothing to keep.
+            continue;
+        }
+        ok = (fprintf(stream, "%s %llu %x\n", result->name, (unsigned long long)duration, (unsigned)failures) > 0);
+    }
+    ok = (fclose(stream) == 0) && ok;
+    return ok;
+}
+
+void rstest_historyChanged(const char *name, void *user)
+{
+    TestHistoryFile_t  *file  = (TestHistoryFile_t *)user;
+    TestHistoryEntry_t *entry = findEntry(&(file->history), name);
+    if ((entry == NULL) && (file->history.count < RSTEST_HISTORY_MAX_ENTRIES) &&
+        (strlen(name) < RSTEST_HISTORY_NAME_SIZE))
+    {
+        (void)strcpy(file->names[file->history.count], name);
+        entry           = &(file->entries[file->history.count]);
+        entry->name     = file->names[file->history.count];
+        entry->duration = 0U;
+        entry->failures = 0U;
+        file->history.count++;
+    }
+    if (entry != NULL)
+    {
+        entry->changed = true;
+    }
+}
@@ -0,0 +1,103 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork checkpoint store and CRC.
+//
+
+#include "rstest/rstest_checkpoint.h"
+#include "rstest_internal.h"
+
+#include <string.h>
+
+/// CRC-32 reflected polynomial (IEEE 802.3).
+#define CRC32_POLY (0xEDB88320U)
+
+/// FNV-1a 32 bit offset basis and prime.
+#define FNV1A_BASIS (0x811C9DC5U)
+#define FNV1A_PRIME (0x01000193U)
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Checkpoint store written while running (NULL when none).
+static const TestCheckpointStore_t *k_store = NULL;
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+bool rstest_checkpointEnabled(void) { return (k_store != NULL); }
+
+void rstest_checkpointSave(TestCheckpoint_t *checkpoint)
+{
+    checkpoint->magic = RSTEST_CHECKPOINT_MAGIC;
+    checkpoint->crc   = rstest_checkpointCrc(checkpoint, offsetof(TestCheckpoint_t, crc));
+    (void)k_store->writeCb(checkpoint, k_store->user);
+}
+
+bool rstest_checkpointLoad(TestCheckpoint_t *checkpoint)
+{
+    return (k_store != NULL) && k_store->readCb(checkpoint, k_store->user) &&
+           (checkpoint->magic == RSTEST_CHECKPOINT_MAGIC) &&
+           (checkpoint->crc == rstest_checkpointCrc(checkpoint, offsetof(TestCheckpoint_t, crc)));
+}
+
+uint32_t rstest_checkpointHash(uint32_t hash, const char *str)
+{
+    hash = (hash == 0U) ? FNV1A_BASIS : hash;
+    for (; (str != NULL) && (*str != '\0'); str++)
+    {
+        hash = (hash ^ (uint8_t)*str) * FNV1A_PRIME;
+    }
+    // Terminator - so "ab","c" differs from "a","bc".
+    return hash * FNV1A_PRIME;
+}
+
+// ------------------------------------------------------------------
+// Checkpoint API
+
+void rstest_setCheckpoint(const TestCheckpointStore_t *store) { k_store = store; }
+
+uint32_t rstest_checkpointCrc(const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t       crc   = 0xFFFFFFFFU;
+    for (size_t idx = 0U; idx < size; idx++)
+    {
+        crc ^= bytes[idx];
+        for (unsigned bit = 0U; bit < 8U; bit++)
+        {
+            crc = (crc >> 1U) ^ (CRC32_POLY & (0U - (crc & 1U)));
+        }
+    }
+    return ~crc;
+}
+
+bool rstest_checkpointRamWrite(const TestCheckpoint_t *checkpoint, void *user)
+{
+    (void)memcpy(user, checkpoint, sizeof(TestCheckpoint_t));
+    return true;
+}
+
+bool rstest_checkpointRamRead(TestCheckpoint_t *checkpoint, void *user)
+{
+    (void)memcpy(checkpoint, user, sizeof(TestCheckpoint_t));
+    return true;
+}
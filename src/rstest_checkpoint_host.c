@@ -0,0 +1,65 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork checkpoint file backend (host only).
+//
+
+#include "rstest/rstest_checkpoint.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ------------------------------------------------------------------
+// Host API
+
+bool rstest_checkpointFileWrite(const TestCheckpoint_t *checkpoint, void *user)
+{
+    // Written to a temporary file then renamed - a reset while writing keeps the previous checkpoint.
+    const char  *path    = (const char *)user;
+    const size_t len     = strlen(path);
+    char        *tmpPath = malloc(len + sizeof(".tmp"));
+    if (tmpPath == NULL)
+    {
+        return false;
+    }
+    memcpy(tmpPath, path, len);
+    memcpy(&tmpPath[len], ".tmp", sizeof(".tmp"));
+
+    FILE *stream = fopen(tmpPath, "wb");
+    bool  ok     = (stream != NULL) && (fwrite(checkpoint, sizeof(TestCheckpoint_t), 1U, stream) == 1U);
+    ok           = (stream != NULL) && (fclose(stream) == 0) && ok;
+    ok           = ok && (rename(tmpPath, path) == 0);
+    free(tmpPath);
+    return ok;
+}
+
+bool rstest_checkpointFileRead(TestCheckpoint_t *checkpoint, void *user)
+{
+    FILE *stream = fopen((const char *)user, "rb");
+    if (stream == NULL)
+    {
+        return false;
+    }
+    const bool ok = (fread(checkpoint, sizeof(TestCheckpoint_t), 1U, stream) == 1U);
+    (void)fclose(stream);
+    return ok;
+}
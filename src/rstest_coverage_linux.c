@@ -0,0 +1,477 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork per test case coverage recording
+/// (Linux host only, -fsanitize-coverage=trace-pc-guard callbacks).
+//
+
+#define _GNU_SOURCE // dladdr
+
+#include "rstest/rstest_coverage.h"
+#include "rstest_internal.h"
+
+#include <dlfcn.h>
+#include <elf.h>
+#include <limits.h>
+#include <link.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/// No test case executing - guards hit are not recorded.
+#define NO_CASE (UINT32_MAX)
+
+/// Bits per bitmap word.
+#define WORD_BITS (64U)
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+/// Coverage info
+typedef struct CoverageInfo_s
+{
+    uint32_t   guardCount; ///< Count of guards, numbered 1 to guardCount
+    uint32_t   words;      ///< Bitmap words per test case (bit index is the guard number)
+    uint64_t  *bitmaps;    ///< MAX_NUM_TESTCASE_RESULTS bitmaps of the guards hit
+    uintptr_t *pcs;        ///< Address of each guard (first hit), indexed by the guard number
+    uint32_t   current;    ///< Index of the test case executing, NO_CASE if none
+    size_t     caseCount;  ///< Count of test cases of the test suite run
+} CoverageInfo_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Coverage (Singleton)
+static CoverageInfo_t k_cov = {0U, 0U, NULL, NULL, NO_CASE, 0U};
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Bitmap of a test case.
+/// @param[in] caseIndex index of the test case within the TestSuite
+/// @returns the bitmap, NULL if none
+static uint64_t *bitmapOf(size_t caseIndex)
+{
+    return ((k_cov.bitmaps != NULL) && (caseIndex < MAX_NUM_TESTCASE_RESULTS))
+               ? &k_cov.bitmaps[caseIndex * k_cov.words]
+               : NULL;
+}
+
+/// Grow the bitmaps and addresses for the current guard count - existing bitmaps are kept.
+/// @param[in] previous guard count before the guards added
+/// @retval true when grown
+/// @retval false when out of memory (coverage is no longer recorded)
+static bool grow(uint32_t previous)
+{
+    const uint32_t words   = (k_cov.guardCount / WORD_BITS) + 1U;
+    uint64_t      *bitmaps = calloc((size_t)MAX_NUM_TESTCASE_RESULTS * words, sizeof(uint64_t));
+    uintptr_t     *pcs     = realloc(k_cov.pcs, ((size_t)k_cov.guardCount + 1U) * sizeof(uintptr_t));
+    if ((bitmaps == NULL) || (pcs == NULL))
+    {
+        free(bitmaps);
+        free((pcs != NULL) ? pcs : k_cov.pcs);
+        free(k_cov.bitmaps);
+        k_cov = (CoverageInfo_t){0U, 0U, NULL, NULL, NO_CASE, k_cov.caseCount};
+        return false;
+    }
+
+    pcs[0] = 0U; // Guard 0 is never hit.
+    for (uint32_t guard = previous + 1U; guard <= k_cov.guardCount; guard++)
+    {
+        pcs[guard] = 0U;
+    }
+    for (size_t idx = 0U; (k_cov.bitmaps != NULL) && (idx < MAX_NUM_TESTCASE_RESULTS); idx++)
+    {
+        memcpy(&bitmaps[idx * words], &k_cov.bitmaps[idx * k_cov.words], k_cov.words * sizeof(uint64_t));
+    }
+    free(k_cov.bitmaps);
+    k_cov.bitmaps = bitmaps;
+    k_cov.pcs     = pcs;
+    k_cov.words   = words;
+    return true;
+}
+
+/// Offset of an address within its module as addr2line expects it.
+/// @param[in] pc address
+/// @param[out] module path of the module containing the address, NULL if unknown
+/// @returns the offset - the address itself for a non position independent executable
+static uintptr_t moduleOffset(uintptr_t pc, const char **module)
+{
+    Dl_info info = {0};
+    if ((dladdr((void *)pc, &info) == 0) || (info.dli_fname == NULL) || (info.dli_fbase == NULL))
+    {
+        *module = NULL;
+        return pc;
+    }
+    *module                = info.dli_fname;
+    const ElfW(Ehdr) *ehdr = (const ElfW(Ehdr) *)info.dli_fbase;
+    return (ehdr->e_type == ET_DYN) ? (pc - (uintptr_t)info.dli_fbase) : pc;
+}
+
+/// Read the function symbols of a module (ELF symbol table, the dynamic one when stripped).
+/// @param[in] module path of the module
+/// @param[out] count count of symbols read
+/// @returns the symbols (free()), NULL when none
+static ElfW(Sym) *readSymbols(const char *module, size_t *count)
+{
+    *count            = 0U;
+    ElfW(Sym) *syms   = NULL;
+    FILE      *stream = fopen(module, "rb");
+    ElfW(Ehdr) ehdr;
+    if ((stream == NULL) || (fread(&ehdr, sizeof(ehdr), 1U, stream) != 1U) ||
+        (memcmp(ehdr.e_ident, ELFMAG, SELFMAG) != 0) || (ehdr.e_shentsize != sizeof(ElfW(Shdr))))
+    {
+        if (stream != NULL)
+        {
+            (void)fclose(stream);
+        }
+        return NULL;
+    }
+
+    ElfW(Shdr) table = {0};
+    for (uint32_t idx = 0U; idx < ehdr.e_shnum; idx++)
+    {
+        ElfW(Shdr) shdr;
+        if ((fseek(stream, (long)(ehdr.e_shoff + ((size_t)idx * sizeof(shdr))), SEEK_SET) != 0) ||
+            (fread(&shdr, sizeof(shdr), 1U, stream) != 1U))
+        {
+            break;
+        }
+        if ((shdr.sh_type == SHT_SYMTAB) || ((shdr.sh_type == SHT_DYNSYM) && (table.sh_type != SHT_SYMTAB)))
+        {
+            table = shdr;
+        }
+    }
+
+    const size_t entries = (table.sh_entsize == sizeof(ElfW(Sym))) ? (table.sh_size / sizeof(ElfW(Sym))) : 0U;
+    syms                 = (entries != 0U) ? malloc(entries * sizeof(ElfW(Sym))) : NULL;
+    if ((syms != NULL) && ((fseek(stream, (long)table.sh_offset, SEEK_SET) != 0) ||
+                           (fread(syms, sizeof(ElfW(Sym)), entries, stream) != entries)))
+    {
+        free(syms);
+        syms = NULL;
+    }
+    *count = (syms != NULL) ? entries : 0U;
+    (void)fclose(stream);
+    return syms;
+}
+
+/// Find the function containing an address of a module.
+/// @param[in] syms symbols of the module
+/// @param[in] count count of symbols
+/// @param[in] offset address within the module (as addr2line expects it)
+/// @param[out] start first address of the function
+/// @param[out] end last address of the function
+/// @retval true when found
+/// @retval false otherwise (start and end are the address)
+static bool functionOf(const ElfW(Sym) *syms, size_t count, uintptr_t offset, uintptr_t *start, uintptr_t *end)
+{
+    *start = offset;
+    *end   = offset;
+    for (size_t idx = 0U; idx < count; idx++)
+    {
+        const ElfW(Sym) *sym = &syms[idx];
+        // ELF32_ST_TYPE and ELF64_ST_TYPE are the same.
+        if ((ELF64_ST_TYPE(sym->st_info) == STT_FUNC) && (sym->st_size != 0U) && (offset >= sym->st_value) &&
+            (offset < (sym->st_value + sym->st_size)))
+        {
+            *start = (uintptr_t)sym->st_value;
+            *end   = (uintptr_t)(sym->st_value + sym->st_size - 1U);
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Line number of an addr2line location.
+/// @param[in] location file:line
+/// @param[out] file length of the file part
+/// @returns the line, 0 when unknown
+static unsigned long lineOf(const char *location, size_t *file)
+{
+    const char *colon = strrchr(location, ':');
+    *file             = (colon != NULL) ? (size_t)(colon - location) : 0U;
+    return (colon != NULL) ? strtoul(colon + 1, NULL, 10) : 0UL;
+}
+
+/// Read a location from addr2line.
+/// @param[in] lines output of addr2line (may be NULL)
+/// @param[out] location file:line, "??:0" when unknown
+/// @param[in] size size of location
+static void readLocation(FILE *lines, char *location, size_t size)
+{
+    if ((lines == NULL) || (fgets(location, (int)size, lines) == NULL))
+    {
+        strcpy(location, "??:0");
+    }
+    // file:line [(discriminator N)]
+    location[strcspn(location, " \r\n")] = '\0';
+}
+
+/// Write the source lines of the guards of one module (addr2line).
+/// Each guard is written with the line range of its function: a guard is at
+/// the start of a basic block, a change to any line of the block (or of the
+/// function) selects the test cases executing it.
+/// @param[in,out] stream coverage map to write to
+/// @param[in,out] modules module of each guard, cleared for the guards written
+/// @param[in] offsets offset of each guard within its module
+/// @param[in] first first guard of the module to write
+/// @retval true when written
+/// @retval false otherwise
+static bool writeModule(FILE *stream, const char **modules, const uintptr_t *offsets, uint32_t first)
+{
+    const char *module    = modules[first];
+    char        tmpPath[] = "/tmp/rstest_coverage_XXXXXX";
+    const int   fd        = mkstemp(tmpPath);
+    FILE       *addrs     = (fd >= 0) ? fdopen(fd, "w") : NULL;
+    if (addrs == NULL)
+    {
+        if (fd >= 0)
+        {
+            (void)close(fd);
+            (void)unlink(tmpPath);
+        }
+        return false;
+    }
+
+    // Per guard: the address returned to from the guard callback - step back into the call
+    // instruction - then the first and last address of its function.
+    size_t     symCount = 0U;
+    ElfW(Sym) *syms     = readSymbols(module, &symCount);
+    bool       ok       = true;
+    for (uint32_t guard = first; ok && (guard <= k_cov.guardCount); guard++)
+    {
+        if ((modules[guard] != NULL) && (strcmp(modules[guard], module) == 0))
+        {
+            uintptr_t start = 0U;
+            uintptr_t end   = 0U;
+            (void)functionOf(syms, symCount, offsets[guard] - 1U, &start, &end);
+            ok = (fprintf(addrs, "0x%lx\n0x%lx\n0x%lx\n", (unsigned long)(offsets[guard] - 1U),
+                          (unsigned long)start, (unsigned long)end) > 0);
+        }
+    }
+    free(syms);
+    ok = (fclose(addrs) == 0) && ok;
+
+    // The module path is quoted for the shell - a path with a quote is not symbolized.
+    char  cmd[PATH_MAX + 64];
+    FILE *lines = NULL;
+    if (ok && (strchr(module, '\'') == NULL) &&
+        (snprintf(cmd, sizeof(cmd), "addr2line -e '%s' < %s", module, tmpPath) < (int)sizeof(cmd)))
+    {
+        lines = popen(cmd, "r");
+    }
+
+    char location[PATH_MAX + 32];
+    char startLocation[PATH_MAX + 32];
+    char endLocation[PATH_MAX + 32];
+    for (uint32_t guard = first; ok && (guard <= k_cov.guardCount); guard++)
+    {
+        if ((modules[guard] == NULL) || (strcmp(modules[guard], module) != 0))
+        {
+            continue;
+        }
+        modules[guard] = NULL;
+        readLocation(lines, location, sizeof(location));
+        readLocation(lines, startLocation, sizeof(startLocation));
+        readLocation(lines, endLocation, sizeof(endLocation));
+
+        // The range of the function when its first and last line are in the file of the guard.
+        size_t              file      = 0U;
+        size_t              startFile = 0U;
+        size_t              endFile   = 0U;
+        const unsigned long lineNum   = lineOf(location, &file);
+        unsigned long       firstLine = lineOf(startLocation, &startFile);
+        unsigned long       lastLine  = lineOf(endLocation, &endFile);
+        if ((firstLine == 0UL) || (startFile != file) || (strncmp(startLocation, location, file) != 0))
+        {
+            firstLine = lineNum;
+        }
+        if ((lastLine == 0UL) || (endFile != file) || (strncmp(endLocation, location, file) != 0))
+        {
+            lastLine = lineNum;
+        }
+        firstLine = (firstLine < lineNum) ? firstLine : lineNum;
+        lastLine  = (lastLine > lineNum) ? lastLine : lineNum;
+        ok        = (lineNum == 0UL) ? (fprintf(stream, "G %u %s\n", guard, location) > 0)
+                                     : (fprintf(stream, "G %u %.*s:%lu-%lu\n", guard, (int)file, location, firstLine,
+                                                lastLine) > 0);
+    }
+    ok = ((lines != NULL) && (pclose(lines) == 0)) && ok;
+    (void)unlink(tmpPath);
+    return ok;
+}
+
+/// Write the source line of every guard hit.
+/// @param[in,out] stream coverage map to write to
+/// @retval true when written
+/// @retval false otherwise
+static bool writeGuards(FILE *stream)
+{
+    const char **modules = calloc((size_t)k_cov.guardCount + 1U, sizeof(const char *));
+    uintptr_t   *offsets = calloc((size_t)k_cov.guardCount + 1U, sizeof(uintptr_t));
+    bool         ok      = (modules != NULL) && (offsets != NULL);
+    for (uint32_t guard = 1U; ok && (guard <= k_cov.guardCount); guard++)
+    {
+        if (k_cov.pcs[guard] != 0U)
+        {
+            offsets[guard] = moduleOffset(k_cov.pcs[guard], &modules[guard]);
+        }
+    }
+    for (uint32_t guard = 1U; ok && (guard <= k_cov.guardCount); guard++)
+    {
+        if (modules[guard] != NULL)
+        {
+            ok = writeModule(stream, modules, offsets, guard);
+        }
+    }
+    free(modules);
+    free(offsets);
+    return ok;
+}
+
+/// Write the bitmap of a test case - hex digits, the lowest guards first.
+/// @param[in,out] stream coverage map to write to
+/// @param[in] bitmap bitmap of the test case
+/// @retval true when written
+/// @retval false otherwise
+static bool writeBitmap(FILE *stream, const uint64_t *bitmap)
+{
+    static const char k_hex[] = "0123456789abcdef";
+    bool              ok      = true;
+    for (uint32_t nibble = 0U; ok && (nibble * 4U <= k_cov.guardCount); nibble++)
+    {
+        const uint32_t bit = nibble * 4U;
+        ok                 = (fputc(k_hex[(bitmap[bit / WORD_BITS] >> (bit % WORD_BITS)) & 0xFU], stream) != EOF);
+    }
+    return ok;
+}
+
+// ------------------------------------------------------------------
+// Sanitizer Coverage Callbacks
+
+void __sanitizer_cov_trace_pc_guard_init(uint32_t *start, uint32_t *stop);
+void __sanitizer_cov_trace_pc_guard(uint32_t *guard);
+
+/// Number the guards of a module - executed once per instrumented module at load.
+/// @param[in,out] start first guard of the module
+/// @param[in] stop end of the guards of the module
+void __sanitizer_cov_trace_pc_guard_init(uint32_t *start, uint32_t *stop)
+{
+    if ((start == stop) || (*start != 0U))
+    {
+        return; // Already numbered.
+    }
+    const uint32_t previous = k_cov.guardCount;
+    for (uint32_t *guard = start; guard < stop; guard++)
+    {
+        *guard = ++k_cov.guardCount;
+    }
+    (void)grow(previous);
+}
+
+/// A guard was hit - record it for the executing test case.
+/// @param[in] guard guard hit
+void __sanitizer_cov_trace_pc_guard(uint32_t *guard)
+{
+    uint64_t *bitmap = (k_cov.current != NO_CASE) ? bitmapOf(k_cov.current) : NULL;
+    if ((bitmap == NULL) || (*guard == 0U) || (*guard > k_cov.guardCount))
+    {
+        return;
+    }
+    bitmap[*guard / WORD_BITS] |= (uint64_t)1U << (*guard % WORD_BITS);
+    if (k_cov.pcs[*guard] == 0U)
+    {
+        k_cov.pcs[*guard] = (uintptr_t)__builtin_return_address(0);
+    }
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_coverageStart(size_t caseCount) { k_cov.caseCount = caseCount; }
+
+void rstest_coverageBegin(size_t caseIndex)
+{
+    uint64_t *bitmap = bitmapOf(caseIndex);
+    if (bitmap != NULL)
+    {
+        memset(bitmap, 0, k_cov.words * sizeof(uint64_t));
+    }
+    rstest_coverageResume(caseIndex);
+}
+
+void rstest_coverageResume(size_t caseIndex)
+{
+    k_cov.current = (caseIndex < MAX_NUM_TESTCASE_RESULTS) ? (uint32_t)caseIndex : NO_CASE;
+}
+
+void rstest_coveragePause(void) { k_cov.current = NO_CASE; }
+
+// ------------------------------------------------------------------
+// Recording API
+
+uint32_t rstest_coverageGuardCount(void) { return k_cov.guardCount; }
+
+bool rstest_coverageHit(size_t caseIndex, uint32_t guard)
+{
+    const uint64_t *bitmap = bitmapOf(caseIndex);
+    return (bitmap != NULL) && (guard != 0U) && (guard <= k_cov.guardCount) &&
+           (((bitmap[guard / WORD_BITS] >> (guard % WORD_BITS)) & 1U) != 0U);
+}
+
+bool rstest_coverageSave(const TestReport_t *report, const char *path)
+{
+    // Test cases beyond MAX_NUM_TESTCASE_RESULTS are not recorded - a partial map would never select them.
+    if (k_cov.caseCount > MAX_NUM_TESTCASE_RESULTS)
+    {
+        return false;
+    }
+
+    FILE *stream = fopen(path, "w");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    bool ok = (fprintf(stream, "# rstest coverage map: %s\n", (report->name != NULL) ? report->name : "") > 0) &&
+              writeGuards(stream);
+    for (size_t idx = 0U; ok && (idx < report->caseResults.count) && (idx < MAX_NUM_TESTCASE_RESULTS); idx++)
+    {
+        const TestCaseResult_t *result = &report->caseResults.records[idx];
+        if (((result->state != TestCaseState_Pass) && (result->state != TestCaseState_Fail)) ||
+            (bitmapOf(idx) == NULL))
+        {
+            continue; // Not executed.
+        }
+        ok = (fprintf(stream, "C %s ", result->name) > 0) && writeBitmap(stream, bitmapOf(idx)) &&
+             (fputc('\n', stream) != EOF);
+    }
+    ok = (fclose(stream) == 0) && ok;
+    return ok;
+}
@@ -0,0 +1,284 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork coverage map test case selection
+/// from a unified diff (host only).
+//
+
+#define _POSIX_C_SOURCE 200809L // getline
+
+#include "rstest/rstest_coverage.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+/// Changed lines of a file (old side of a diff hunk).
+typedef struct ChangedRange_s
+{
+    char    *path;  ///< Path of the file as in the diff (a/ prefix removed)
+    uint32_t first; ///< First changed line
+    uint32_t last;  ///< Last changed line
+} ChangedRange_t;
+
+/// Changed lines of a diff.
+typedef struct ChangedList_s
+{
+    ChangedRange_t *ranges;   ///< Ranges of changed lines
+    size_t          count;    ///< Count of ranges
+    size_t          capacity; ///< Allocated ranges
+} ChangedList_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Add a range of changed lines.
+/// @param[in,out] list changed lines
+/// @param[in] path path of the file (copied)
+/// @param[in] first first changed line
+/// @param[in] last last changed line
+/// @retval true when added
+/// @retval false when out of memory
+static bool addRange(ChangedList_t *list, const char *path, uint32_t first, uint32_t last)
+{
+    if (list->count == list->capacity)
+    {
+        const size_t    capacity = (list->capacity == 0U) ? 16U : (list->capacity * 2U);
+        ChangedRange_t *ranges   = realloc(list->ranges, capacity * sizeof(ChangedRange_t));
+        if (ranges == NULL)
+        {
+            return false;
+        }
+        list->ranges   = ranges;
+        list->capacity = capacity;
+    }
+    char *copy = malloc(strlen(path) + 1U);
+    if (copy == NULL)
+    {
+        return false;
+    }
+    strcpy(copy, path);
+    list->ranges[list->count++] = (ChangedRange_t){copy, first, last};
+    return true;
+}
+
+/// Free the changed lines.
+/// @param[in,out] list changed lines
+static void freeRanges(ChangedList_t *list)
+{
+    for (size_t idx = 0U; idx < list->count; idx++)
+    {
+        free(list->ranges[idx].path);
+    }
+    free(list->ranges);
+    *list = (ChangedList_t){NULL, 0U, 0U};
+}
+
+/// Read the changed lines of a unified diff - the old side of each hunk.
+/// A pure insertion (count 0) changes the lines either side of it.
+/// @param[in] stream unified diff
+/// @param[out] list changed lines
+/// @retval true when read
+/// @retval false when out of memory
+static bool readDiff(FILE *stream, ChangedList_t *list)
+{
+    char  *line = NULL;
+    size_t size = 0U;
+    char  *path = NULL;
+    bool   ok   = true;
+    while (ok && (getline(&line, &size, stream) > 0))
+    {
+        line[strcspn(line, "\t\r\n")] = '\0';
+        unsigned long start           = 0UL;
+        unsigned long count           = 1UL;
+        if (strncmp(line, "--- ", 4U) == 0)
+        {
+            const char *name = line + 4;
+            free(path);
+            path = NULL;
+            if (strcmp(name, "/dev/null") != 0)
+            {
+                name = (strncmp(name, "a/", 2U) == 0) ? (name + 2) : name;
+                path = malloc(strlen(name) + 1U);
+                ok   = (path != NULL);
+                if (ok)
+                {
+                    strcpy(path, name);
+                }
+            }
+        }
+        else if ((path != NULL) && ((sscanf(line, "@@ -%lu,%lu", &start, &count) == 2) ||
+                                    (sscanf(line, "@@ -%lu", &start) == 1)))
+        {
+            ok = (count == 0UL) ? addRange(list, path, (uint32_t)start, (uint32_t)start + 1U)
+                                : addRange(list, path, (uint32_t)start, (uint32_t)(start + count - 1UL));
+        }
+    }
+    free(path);
+    free(line);
+    return ok;
+}
+
+/// Is a source file of the map the file of a diff?
+/// The diff path is relative to the repository, the map path is as compiled.
+/// @param[in] mapPath path in the coverage map
+/// @param[in] mapLen length of the map path
+/// @param[in] diffPath path in the diff
+/// @retval true when the map path ends with the diff path
+static bool samePath(const char *mapPath, size_t mapLen, const char *diffPath)
+{
+    const size_t diffLen = strlen(diffPath);
+    return (mapLen >= diffLen) && (strncmp(mapPath + mapLen - diffLen, diffPath, diffLen) == 0) &&
+           ((mapLen == diffLen) || (mapPath[mapLen - diffLen - 1U] == '/'));
+}
+
+/// Is a source line range changed?
+/// @param[in] list changed lines
+/// @param[in] location source lines of a guard - file:first-last (its function), or file:line
+/// @retval true when changed
+static bool changedLine(const ChangedList_t *list, const char *location)
+{
+    const char *colon = strrchr(location, ':');
+    if (colon == NULL)
+    {
+        return false;
+    }
+    char               *end       = NULL;
+    const unsigned long firstLine = strtoul(colon + 1, &end, 10);
+    const unsigned long lastLine  = (*end == '-') ? strtoul(end + 1, NULL, 10) : firstLine;
+    for (size_t idx = 0U; idx < list->count; idx++)
+    {
+        const ChangedRange_t *range = &list->ranges[idx];
+        if ((firstLine <= range->last) && (lastLine >= range->first) &&
+            samePath(location, (size_t)(colon - location), range->path))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Does a test case bitmap hit a changed guard?
+/// @param[in] bitmap hex digits of the test case, the lowest guards first
+/// @param[in] changed changed guards
+/// @param[in] changedCount count of changed guards (numbered 0 to changedCount - 1)
+/// @retval true when hit
+static bool hitsChanged(const char *bitmap, const bool *changed, size_t changedCount)
+{
+    for (size_t nibble = 0U; bitmap[nibble] != '\0'; nibble++)
+    {
+        const char *const k_hex = "0123456789abcdef";
+        const char       *digit = strchr(k_hex, bitmap[nibble]);
+        const unsigned    bits  = (digit != NULL) ? (unsigned)(digit - k_hex) : 0U;
+        for (size_t bit = 0U; bit < 4U; bit++)
+        {
+            const size_t guard = (nibble * 4U) + bit;
+            if ((((bits >> bit) & 1U) != 0U) && (guard < changedCount) && changed[guard])
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------
+// Selection API
+
+bool rstest_coverageSelect(const char *mapPath, const char *diffPath, TestCoverageSelectCb_t selectCb, void *user)
+{
+    ChangedList_t list = {NULL, 0U, 0U};
+    FILE         *diff = (diffPath != NULL) ? fopen(diffPath, "r") : NULL;
+    bool          ok   = (diff != NULL) && readDiff(diff, &list);
+    if (diff != NULL)
+    {
+        (void)fclose(diff);
+    }
+
+    FILE *map = ok ? fopen(mapPath, "r") : NULL;
+    ok        = ok && (map != NULL);
+
+    // G <guard> <file>:<line> lines come before the C <name> <bitmap> lines.
+    bool  *changed      = NULL;
+    size_t changedCount = 0U;
+    char  *line         = NULL;
+    size_t size         = 0U;
+    while (ok && (getline(&line, &size, map) > 0))
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        char *field                 = strchr(line, ' ');
+        char *value                 = (field != NULL) ? strchr(field + 1, ' ') : NULL;
+        if ((line[0] == '#') || (line[0] == '\0'))
+        {
+            continue;
+        }
+        ok = (value != NULL);
+        if (ok && (line[0] == 'G'))
+        {
+            const unsigned long guard = strtoul(field + 1, NULL, 10);
+            if (guard >= changedCount)
+            {
+                const size_t count = guard + 1U + (changedCount / 2U);
+                bool        *grown = realloc(changed, count * sizeof(bool));
+                ok                 = (grown != NULL);
+                if (ok)
+                {
+                    memset(&grown[changedCount], 0, (count - changedCount) * sizeof(bool));
+                    changed      = grown;
+                    changedCount = count;
+                }
+            }
+            if (ok)
+            {
+                changed[guard] = changedLine(&list, value + 1);
+            }
+        }
+        else if (ok && (line[0] == 'C'))
+        {
+            *value = '\0';
+            if (hitsChanged(value + 1, changed, changedCount))
+            {
+                selectCb(field + 1, user);
+            }
+        }
+        else
+        {
+            ok = false; // Malformed map.
+        }
+    }
+    if (map != NULL)
+    {
+        (void)fclose(map);
+    }
+    free(line);
+    free(changed);
+    freeRanges(&list);
+    return ok;
+}
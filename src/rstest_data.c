@@ -0,0 +1,327 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork test data generation.
+//
+
+#include "rstest/rstest_data.h"
+#include "rstest_internal.h"
+
+#include <float.h>
+#include <string.h>
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Datasets within the pool of a cache are aligned for any element type.
+#define DATA_ALIGN (sizeof(uint64_t))
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Rotate a word left.
+/// @param[in] value word
+/// @param[in] count bits to rotate by (1..31)
+/// @returns the rotated word
+static inline uint32_t rotl32(uint32_t value, uint32_t count)
+{
+    return (value << count) | (value >> (32U - count));
+}
+
+/// Next value of splitmix64 - expands a seed into generator state.
+/// @param[in,out] state state of splitmix64
+/// @returns the value
+static uint64_t splitmix64(uint64_t *state)
+{
+    uint64_t value = (*state += 0x9E3779B97F4A7C15ULL);
+    value          = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    value          = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31U);
+}
+
+/// Float bound of a dataset - a double beyond the float range is clamped to it.
+/// @param[in] bound lowest or highest value of the dataset
+/// @returns the float bound
+static float floatBound(double bound)
+{
+    if (bound > (double)FLT_MAX)
+    {
+        return FLT_MAX;
+    }
+    if (bound < -(double)FLT_MAX)
+    {
+        return -FLT_MAX;
+    }
+    return (float)bound;
+}
+
+/// Generate a word of every lane (xoshiro128**) - a loop over the lanes the compiler vectorizes.
+/// @param[in,out] rng generator
+/// @param[out] words RSTEST_RANDOM_LANES words, lane 0 first
+static void randomLanes(TestRandom_t *rng, uint32_t *words)
+{
+    uint32_t *s0 = rng->state[0];
+    uint32_t *s1 = rng->state[1];
+    uint32_t *s2 = rng->state[2];
+    uint32_t *s3 = rng->state[3];
+    for (uint32_t lane = 0U; lane < RSTEST_RANDOM_LANES; lane++)
+    {
+        const uint32_t t = s1[lane] << 9U;
+        words[lane]      = rotl32(s1[lane] * 5U, 7U) * 9U;
+        s2[lane] ^= s0[lane];
+        s3[lane] ^= s1[lane];
+        s1[lane] ^= s2[lane];
+        s0[lane] ^= s3[lane];
+        s2[lane] ^= t;
+        s3[lane] = rotl32(s3[lane], 11U);
+    }
+}
+
+/// Uniform value below a range - Lemire's multiply and reject, unbiased.
+/// @param[in,out] rng generator
+/// @param[in] range count of values, not 0
+/// @returns the value within [0, range)
+static uint32_t randomBelow(TestRandom_t *rng, uint32_t range)
+{
+    uint64_t product = (uint64_t)rstest_random32(rng) * range;
+    uint32_t low     = (uint32_t)product;
+    if (low < range)
+    {
+        const uint32_t threshold = (0U - range) % range;
+        while (low < threshold)
+        {
+            product = (uint64_t)rstest_random32(rng) * range;
+            low     = (uint32_t)product;
+        }
+    }
+    return (uint32_t)(product >> 32U);
+}
+
+/// Does a cache entry hold the dataset of a description?
+/// @param[in] entry cache entry
+/// @param[in] spec description of the dataset
+/// @retval true when the same dataset
+static bool sameSpec(const TestDataCacheEntry_t *entry, const TestDataSpec_t *spec)
+{
+    // The range compared bitwise - the same description, not equal values.
+    return (entry->spec.type == spec->type) && (entry->spec.seed == spec->seed) &&
+           (entry->spec.count == spec->count) && (memcmp(&(entry->spec.min), &(spec->min), sizeof(double)) == 0) &&
+           (memcmp(&(entry->spec.max), &(spec->max), sizeof(double)) == 0);
+}
+
+// ------------------------------------------------------------------
+// Random API
+
+void rstest_randomSeed(TestRandom_t *rng, uint64_t seed)
+{
+    uint64_t state = seed;
+    for (uint32_t lane = 0U; lane < RSTEST_RANDOM_LANES; lane++)
+    {
+        const uint64_t low  = splitmix64(&state);
+        const uint64_t high = splitmix64(&state);
+        rng->state[0][lane] = (uint32_t)low;
+        rng->state[1][lane] = (uint32_t)(low >> 32U);
+        rng->state[2][lane] = (uint32_t)high;
+        rng->state[3][lane] = (uint32_t)(high >> 32U) | 1U; // Never an all zero state.
+    }
+    rng->next = RSTEST_RANDOM_LANES;
+}
+
+uint32_t rstest_random32(TestRandom_t *rng)
+{
+    if (rng->next == RSTEST_RANDOM_LANES)
+    {
+        randomLanes(rng, rng->words);
+        rng->next = 0U;
+    }
+    return rng->words[rng->next++];
+}
+
+void rstest_randomU32(TestRandom_t *rng, uint32_t *values, size_t count)
+{
+    size_t idx = 0U;
+    // Words left over from the previous fill first, then whole lanes straight into the values.
+    for (; (idx < count) && (rng->next != RSTEST_RANDOM_LANES); idx++)
+    {
+        values[idx] = rstest_random32(rng);
+    }
+    for (; (count - idx) >= RSTEST_RANDOM_LANES; idx += RSTEST_RANDOM_LANES)
+    {
+        randomLanes(rng, &(values[idx]));
+    }
+    for (; idx < count; idx++)
+    {
+        values[idx] = rstest_random32(rng);
+    }
+}
+
+void rstest_randomBytes(TestRandom_t *rng, uint8_t *values, size_t count)
+{
+    uint32_t words[RSTEST_RANDOM_LANES];
+    size_t   idx = 0U;
+    while (idx < count)
+    {
+        const size_t left = count - idx;
+        size_t       used = (left + 3U) / 4U;
+        used              = (used < RSTEST_RANDOM_LANES) ? used : RSTEST_RANDOM_LANES;
+        rstest_randomU32(rng, words, used);
+        for (size_t byte = 0U; (byte < (used * 4U)) && (idx < count); byte++, idx++)
+        {
+            values[idx] = (uint8_t)(words[byte / 4U] >> (8U * (byte % 4U)));
+        }
+    }
+}
+
+void rstest_randomI32(TestRandom_t *rng, int32_t *values, size_t count, int32_t min, int32_t max)
+{
+    const uint32_t span = (uint32_t)max - (uint32_t)min; // Range - 1, wraps for the whole range.
+    for (size_t idx = 0U; idx < count; idx++)
+    {
+        const uint32_t offset = (span == UINT32_MAX) ? rstest_random32(rng) : randomBelow(rng, span + 1U);
+        values[idx]           = (int32_t)((uint32_t)min + offset);
+    }
+}
+
+void rstest_randomFloat(TestRandom_t *rng, float *values, size_t count, float min, float max)
+{
+    for (size_t idx = 0U; idx < count; idx++)
+    {
+        // Weighted bounds rather than min + u * (max - min) - the span of a wide range overflows.
+        // The sum can round up to max - drawn again, max is exclusive.
+        float value = min;
+        do
+        {
+            const float u = (float)(rstest_random32(rng) >> 8U) * (1.0F / 16777216.0F);
+            value         = (min * (1.0F - u)) + (max * u);
+        } while ((value >= max) && (min < max));
+        values[idx] = value;
+    }
+}
+
+void rstest_randomDouble(TestRandom_t *rng, double *values, size_t count, double min, double max)
+{
+    for (size_t idx = 0U; idx < count; idx++)
+    {
+        // Weighted bounds as for floats - the sum can round up to max, drawn again.
+        double value = min;
+        do
+        {
+            const uint64_t high = rstest_random32(rng) >> 5U;
+            const uint64_t low  = rstest_random32(rng) >> 6U;
+            const double   u    = (double)((high << 26U) | low) * (1.0 / 9007199254740992.0);
+            value               = (min * (1.0 - u)) + (max * u);
+        } while ((value >= max) && (min < max));
+        values[idx] = value;
+    }
+}
+
+// ------------------------------------------------------------------
+// Dataset API
+
+size_t rstest_dataSize(const TestDataSpec_t *spec)
+{
+    switch (spec->type)
+    {
+    case TestDataType_Bytes:
+        return spec->count * sizeof(uint8_t);
+    case TestDataType_U32:
+        return spec->count * sizeof(uint32_t);
+    case TestDataType_I32:
+        return spec->count * sizeof(int32_t);
+    case TestDataType_Float:
+        return spec->count * sizeof(float);
+    case TestDataType_Double:
+        return spec->count * sizeof(double);
+    default:
+        return 0U;
+    }
+}
+
+bool rstest_dataFill(const TestDataSpec_t *spec, void *data)
+{
+    if ((spec->type == TestDataType_I32) && (spec->min > spec->max))
+    {
+        return false;
+    }
+
+    TestRandom_t rng;
+    rstest_randomSeed(&rng, spec->seed);
+    switch (spec->type)
+    {
+    case TestDataType_Bytes:
+        rstest_randomBytes(&rng, (uint8_t *)data, spec->count);
+        break;
+    case TestDataType_U32:
+        rstest_randomU32(&rng, (uint32_t *)data, spec->count);
+        break;
+    case TestDataType_I32:
+        rstest_randomI32(&rng, (int32_t *)data, spec->count, (int32_t)spec->min, (int32_t)spec->max);
+        break;
+    case TestDataType_Float:
+        rstest_randomFloat(&rng, (float *)data, spec->count, floatBound(spec->min), floatBound(spec->max));
+        break;
+    case TestDataType_Double:
+        rstest_randomDouble(&rng, (double *)data, spec->count, spec->min, spec->max);
+        break;
+    default:
+        return false;
+    }
+    rstest_dataUsed(spec->seed);
+    return true;
+}
+
+const void *rstest_dataGet(TestDataCache_t *cache, const TestDataSpec_t *spec)
+{
+    for (size_t idx = 0U; idx < cache->count; idx++)
+    {
+        if (sameSpec(&(cache->entries[idx]), spec))
+        {
+            rstest_dataUsed(spec->seed);
+            return cache->entries[idx].data;
+        }
+    }
+
+    const size_t    size    = rstest_dataSize(spec);
+    const uintptr_t base    = (uintptr_t)cache->pool;
+    const uintptr_t aligned = (base + cache->poolUsed + (DATA_ALIGN - 1U)) & ~(uintptr_t)(DATA_ALIGN - 1U);
+    const size_t    start   = (size_t)(aligned - base);
+    if ((cache->count == cache->capacity) || (size == 0U) || (start > cache->poolSize) ||
+        (size > (cache->poolSize - start)))
+    {
+        return NULL;
+    }
+    void *data = &(cache->pool[start]);
+    if (!rstest_dataFill(spec, data))
+    {
+        return NULL;
+    }
+    cache->entries[cache->count].spec = *spec;
+    cache->entries[cache->count].data = data;
+    cache->count++;
+    cache->poolUsed = start + size;
+    return data;
+}
+
+void rstest_dataCacheClear(TestDataCache_t *cache)
+{
+    cache->count    = 0U;
+    cache->poolUsed = 0U;
+}
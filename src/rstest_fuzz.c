@@ -0,0 +1,155 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork fuzzing harness.
+//
+
+#include "rstest/rstest_fuzz.h"
+#include "rstest_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+/// Parameter buffer - aligned for any parameter type.
+typedef union FuzzParam_u
+{
+    uint8_t     bytes[RSTEST_FUZZ_MAX_PARAM_SIZE]; ///< Raw parameter bytes
+    uint64_t    u64;                               ///< Alignment
+    long double ld;                                ///< Alignment
+    void       *ptr;                               ///< Alignment
+} FuzzParam_t;
+
+/// Fuzzing harness control block
+typedef struct FuzzInfo_s
+{
+    size_t      count;                        ///< Count of fuzzable test cases
+    size_t      cases[RSTEST_FUZZ_MAX_CASES]; ///< Index of the fuzzable test cases within the TestSuite
+    size_t      sizes[RSTEST_FUZZ_MAX_CASES]; ///< paramSize of the fuzzable test cases
+    FuzzParam_t param;                        ///< Parameter of the current input
+} FuzzInfo_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Fuzzing harness Control Block (Singleton)
+static FuzzInfo_t k_fuzz = {0};
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Is a test case fuzzable - an enabled parameterized test case taking its parameter as input?
+/// Benchmark and stress test cases are parameterized by their definition, not by input.
+/// @param[in] testCase test case
+/// @retval true when fuzzable
+static bool fuzzable(const TestCase_t *testCase)
+{
+    return (testCase->paramFunc != NULL) && (testCase->paramFunc != &rstest_benchAB) &&
+           (testCase->paramFunc != &rstest_stressCase) && (testCase->state != TestCaseState_Disabled);
+}
+
+// ------------------------------------------------------------------
+// Harness API
+
+bool rstest_fuzzInit(const TestSuite_t *testSuite)
+{
+    k_fuzz.count = 0U;
+    if ((testSuite == NULL) || !rstest_init(testSuite))
+    {
+        return false;
+    }
+
+    for (size_t idx = 0U; (idx < testSuite->count) && (k_fuzz.count < RSTEST_FUZZ_MAX_CASES); idx++)
+    {
+        const TestCase_t *testCase = &(testSuite->testCases[idx]);
+        if (!fuzzable(testCase))
+        {
+            continue;
+        }
+        if (testCase->paramSize > RSTEST_FUZZ_MAX_PARAM_SIZE)
+        {
+            k_fuzz.count = 0U;
+            return false;
+        }
+        k_fuzz.cases[k_fuzz.count] = idx;
+        k_fuzz.sizes[k_fuzz.count] = testCase->paramSize;
+        k_fuzz.count++;
+    }
+
+    rstest_setAbortOnFailure(true);
+    return (k_fuzz.count != 0U);
+}
+
+int rstest_fuzzOne(const uint8_t *data, size_t size)
+{
+    if (k_fuzz.count == 0U)
+    {
+        abort(); // Not initialized - rstest_fuzzInit() failed or not called.
+    }
+
+    // Select the test case.
+    size_t select = 0U;
+    if ((k_fuzz.count > 1U) && (size > 0U))
+    {
+        select = data[0] % k_fuzz.count;
+        data++;
+        size--;
+    }
+
+    // Parameter - copied to aligned storage, zero padded.
+    const size_t paramSize = k_fuzz.sizes[select];
+    const size_t copySize  = (size < paramSize) ? size : paramSize;
+    if (copySize != 0U)
+    {
+        memcpy(k_fuzz.param.bytes, data, copySize);
+    }
+    memset(&(k_fuzz.param.bytes[copySize]), 0, paramSize - copySize);
+
+    if (rstest_executeParam(k_fuzz.cases[select], k_fuzz.param.bytes) != TestCaseState_Pass)
+    {
+        abort(); // Ended without passing (e.g. missing END_TESTCASE_PASS()).
+    }
+    return 0;
+}
+
+// ------------------------------------------------------------------
+// libFuzzer API
+
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+    (void)argc;
+    (void)argv;
+    if (!rstest_fuzzInit(rstest_fuzzTestSuite()))
+    {
+        abort(); // Nothing to fuzz.
+    }
+    return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) { return rstest_fuzzOne(data, size); }
@@ -0,0 +1,109 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork fuzzing harness main for toolchains
+/// without libFuzzer.
+/// Replays every file given on the command line (e.g. a crash or corpus
+/// entry found with libFuzzer) or standard input when none are given.
+/// When built with AFL++ (afl-clang-fast/afl-gcc-fast) standard input is
+/// executed in persistent mode - many inputs per process.
+//
+
+#include "rstest/rstest_fuzz.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wreserved-identifier"
+#endif
+
+/// Maximum size of a replayed input.
+#if !defined(RSTEST_FUZZ_MAX_INPUT_SIZE)
+#define RSTEST_FUZZ_MAX_INPUT_SIZE (1024U * 1024U)
+#endif
+
+/// Inputs executed per process in AFL++ persistent mode.
+#define AFL_PERSISTENT_COUNT (100000)
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Input buffer
+static uint8_t k_input[RSTEST_FUZZ_MAX_INPUT_SIZE];
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Execute a single input read from a file.
+/// @param[in] file file to read the input from
+/// @retval true if executed
+/// @retval false if unable to read
+static bool runFile(FILE *file)
+{
+    const size_t size = fread(k_input, 1U, sizeof(k_input), file);
+    if (ferror(file) != 0)
+    {
+        return false;
+    }
+    (void)LLVMFuzzerTestOneInput(k_input, size);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    (void)LLVMFuzzerInitialize(&argc, &argv);
+
+    if (argc <= 1)
+    {
+#if defined(__AFL_HAVE_MANUAL_CONTROL)
+        __AFL_INIT();
+        while (__AFL_LOOP(AFL_PERSISTENT_COUNT))
+        {
+            (void)runFile(stdin);
+        }
+        return EXIT_SUCCESS;
+#else
+        return runFile(stdin) ? EXIT_SUCCESS : EXIT_FAILURE;
+#endif
+    }
+
+    for (int idx = 1; idx < argc; idx++)
+    {
+        FILE *file = fopen(argv[idx], "rb");
+        if ((file == NULL) || !runFile(file))
+        {
+            (void)fprintf(stderr, "Unable to read: %s\n", argv[idx]);
+            if (file != NULL)
+            {
+                (void)fclose(file);
+            }
+            return EXIT_FAILURE;
+        }
+        (void)fclose(file);
+    }
+    return EXIT_SUCCESS;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,195 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork golden file comparison (host only, mmap).
+//
+
+#define _DEFAULT_SOURCE // madvise
+
+#include "rstest/rstest_golden.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// Bytes compared per memcmp() - the first differing byte is searched within the differing block only.
+#define GOLDEN_BLOCK_SIZE (4096U)
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Write the actual output on mismatch.
+static bool k_writeActual = false;
+
+// Offset of the first differing byte of the latest mismatch.
+static size_t k_mismatchOffset = RSTEST_GOLDEN_NO_MISMATCH;
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Offset of the first differing byte.
+/// Compares blocks with memcmp() (vectorized by the C library) then bytes of the differing block.
+/// @param[in] golden golden bytes
+/// @param[in] actual actual bytes
+/// @param[in] len count of bytes to compare
+/// @returns the offset, len when they match
+static size_t firstDifference(const uint8_t *golden, const uint8_t *actual, size_t len)
+{
+    for (size_t offset = 0U; offset < len; offset += GOLDEN_BLOCK_SIZE)
+    {
+        const size_t block = ((len - offset) < GOLDEN_BLOCK_SIZE) ? (len - offset) : GOLDEN_BLOCK_SIZE;
+        if (memcmp(&golden[offset], &actual[offset], block) != 0)
+        {
+            size_t idx = offset;
+            while (golden[idx] == actual[idx])
+            {
+                idx++;
+            }
+            return idx;
+        }
+    }
+    return len;
+}
+
+/// Report a mismatch - start writing the actual output if enabled.
+/// The output compared before the mismatch matched, so it is written from the golden file.
+/// @param[in,out] golden comparison
+/// @param[in] offset offset of the first differing byte
+static void mismatch(TestGolden_t *golden, size_t offset)
+{
+    golden->mismatch = true;
+    k_mismatchOffset = offset;
+    if (!k_writeActual)
+    {
+        return;
+    }
+
+    const size_t len  = strlen(golden->path);
+    char        *path = malloc(len + sizeof(".actual"));
+    if (path != NULL)
+    {
+        memcpy(path, golden->path, len);
+        memcpy(&path[len], ".actual", sizeof(".actual"));
+        golden->actual = fopen(path, "wb");
+        free(path);
+    }
+    const size_t matched = (golden->offset < golden->size) ? golden->offset : golden->size;
+    if ((golden->actual != NULL) && (matched != 0U))
+    {
+        (void)fwrite(golden->data, 1U, matched, (FILE *)golden->actual);
+    }
+}
+
+// ------------------------------------------------------------------
+// Host API
+
+void rstest_goldenWriteActual(bool enable) { k_writeActual = enable; }
+
+size_t rstest_goldenMismatchOffset(void) { return k_mismatchOffset; }
+
+bool rstest_goldenMatch(const void *buf, size_t len, const char *path)
+{
+    TestGolden_t golden;
+    bool         ok = rstest_goldenOpen(&golden, path) && rstest_goldenChunk(&golden, buf, len);
+    ok              = rstest_goldenClose(&golden) && ok;
+    return ok;
+}
+
+bool rstest_goldenOpen(TestGolden_t *golden, const char *path)
+{
+    *golden = (TestGolden_t){path, NULL, 0U, 0U, NULL, true};
+
+    const int   fd = open(path, O_RDONLY);
+    struct stat st;
+    if ((fd < 0) || (fstat(fd, &st) != 0) || !S_ISREG(st.st_mode))
+    {
+        if (fd >= 0)
+        {
+            (void)close(fd);
+        }
+        return false;
+    }
+
+    // An empty file cannot be mapped - it is compared without data.
+    golden->size = (size_t)st.st_size;
+    if (golden->size != 0U)
+    {
+        void *data = mmap(NULL, golden->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            (void)close(fd);
+            return false;
+        }
+        (void)madvise(data, golden->size, MADV_SEQUENTIAL);
+        golden->data = (const uint8_t *)data;
+    }
+    (void)close(fd);
+    golden->mismatch = false;
+    return true;
+}
+
+bool rstest_goldenChunk(TestGolden_t *golden, const void *buf, size_t len)
+{
+    bool ok = true;
+    if (!golden->mismatch)
+    {
+        // Output beyond the end of the golden file does not match.
+        const size_t remaining = (golden->offset < golden->size) ? (golden->size - golden->offset) : 0U;
+        const size_t compared  = (len < remaining) ? len : remaining;
+        const size_t diff =
+            (compared != 0U) ? firstDifference(&golden->data[golden->offset], (const uint8_t *)buf, compared) : 0U;
+        ok = (diff == len);
+        if (!ok)
+        {
+            mismatch(golden, golden->offset + diff);
+        }
+    }
+    if ((golden->actual != NULL) && (len != 0U))
+    {
+        (void)fwrite(buf, 1U, len, (FILE *)golden->actual);
+    }
+    golden->offset += len;
+    return ok;
+}
+
+bool rstest_goldenClose(TestGolden_t *golden)
+{
+    const bool ok = golden->mismatch || (golden->offset == golden->size);
+    if (!ok)
+    {
+        mismatch(golden, golden->offset);
+    }
+    if (golden->actual != NULL)
+    {
+        (void)fclose((FILE *)golden->actual);
+        golden->actual = NULL;
+    }
+    if (golden->data != NULL)
+    {
+        (void)munmap((void *)(uintptr_t)golden->data, golden->size);
+        golden->data = NULL;
+    }
+    return ok;
+}
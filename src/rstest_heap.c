@@ -0,0 +1,282 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork heap usage instrumentation.
+//
+
+#include "rstest/rstest_heap.h"
+#include "rstest_internal.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#if defined(RSTEST_HEAP_WRAP)
+// Link time interposition (-Wl,--wrap=<symbol>) - the real allocator is
+// __real_<symbol> and all calls from the linked objects go to __wrap_<symbol>.
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wreserved-identifier"
+#pragma clang diagnostic ignored "-Wmissing-prototypes"
+#endif
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t num, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void  __real_free(void *ptr);
+#define RAW_MALLOC  __real_malloc
+#define RAW_CALLOC  __real_calloc
+#define RAW_REALLOC __real_realloc
+#define RAW_FREE    __real_free
+#else
+#define RAW_MALLOC  malloc
+#define RAW_CALLOC  calloc
+#define RAW_REALLOC realloc
+#define RAW_FREE    free
+#endif // defined(RSTEST_HEAP_WRAP)
+
+#if defined(RSTEST_HEAP_TRACKING)
+
+/// Serialize the tracking - stress test case bodies allocate from several threads.
+#if defined(__GNUC__) || defined(__clang__)
+#define HEAP_LOCK()                                              \
+    while (__atomic_test_and_set(&k_heapLock, __ATOMIC_ACQUIRE)) \
+    {                                                            \
+    }
+#define HEAP_UNLOCK() __atomic_clear(&k_heapLock, __ATOMIC_RELEASE)
+#else
+#define HEAP_LOCK()
+#define HEAP_UNLOCK()
+#endif
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+/// Live allocation record
+typedef struct HeapAlloc_s
+{
+    uintptr_t addr; ///< Allocated memory address
+    size_t    size; ///< Allocated size
+} HeapAlloc_t;
+
+/// Heap tracking control block
+typedef struct HeapInfo_s
+{
+    bool            active;                        ///< Tracking is active (test case executing)
+    TestHeapStats_t stats;                         ///< Statistics of the current test case
+    size_t          liveBytes;                     ///< Currently live bytes
+    size_t          liveCount;                     ///< Count of valid entries in live
+    HeapAlloc_t     live[RSTEST_HEAP_MAX_TRACKED]; ///< Live allocations
+} HeapInfo_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Heap tracking Control Block (Singleton)
+static HeapInfo_t k_heap = {0};
+
+// Lock of the tracking (HEAP_LOCK).
+static bool k_heapLock = false;
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Check a single heap limit and fail the current test case if exceeded.
+/// @param[in] rec assertion record identifying the limit
+/// @param[in] value measured value
+/// @param[in] limit limit value
+static void checkLimit(const AssertRecord_t *rec, size_t value, size_t limit)
+{
+    if (value > limit)
+    {
+        rstest_addAssertion(rec, false);
+    }
+}
+
+/// Track an allocation against the current test case.
+/// @param[in] addr allocated memory address (0 is ignored)
+/// @param[in] size number of bytes allocated
+static void trackAlloc(uintptr_t addr, size_t size)
+{
+    if (!k_heap.active || (addr == 0U))
+    {
+        return;
+    }
+
+    HEAP_LOCK();
+    k_heap.stats.allocCount++;
+    k_heap.stats.allocBytes += size;
+    if (k_heap.liveCount >= RSTEST_HEAP_MAX_TRACKED)
+    {
+        // Unable to match on free - so not part of live/leaked.
+        k_heap.stats.untrackedCount++;
+    }
+    else
+    {
+        k_heap.live[k_heap.liveCount] = (HeapAlloc_t){addr, size};
+        k_heap.liveCount++;
+        k_heap.liveBytes += size;
+        if (k_heap.liveBytes > k_heap.stats.peakBytes)
+        {
+            k_heap.stats.peakBytes = k_heap.liveBytes;
+        }
+    }
+    HEAP_UNLOCK();
+}
+
+/// Track a free against the current test case.
+/// @param[in] addr freed memory address (0 is ignored)
+static void trackFree(uintptr_t addr)
+{
+    if (!k_heap.active || (addr == 0U))
+    {
+        return;
+    }
+
+    // Search from most recent - typically freed in reverse order of allocation.
+    // Not found when allocated outside of the test case - ignore.
+    HEAP_LOCK();
+    for (size_t idx = k_heap.liveCount; idx > 0U; idx--)
+    {
+        HeapAlloc_t *alloc = &(k_heap.live[idx - 1U]);
+        if (alloc->addr == addr)
+        {
+            k_heap.stats.freeCount++;
+            k_heap.liveBytes -= alloc->size;
+            k_heap.liveCount--;
+            *alloc = k_heap.live[k_heap.liveCount];
+            break;
+        }
+    }
+    HEAP_UNLOCK();
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_heapBegin(void)
+{
+    k_heap.stats     = (TestHeapStats_t){0};
+    k_heap.liveBytes = 0U;
+    k_heap.liveCount = 0U;
+    k_heap.active    = true;
+}
+
+void rstest_heapEnd(TestHeapStats_t *stats, const TestHeapLimits_t *limits)
+{
+    k_heap.active            = false;
+    k_heap.stats.leakedBytes = k_heap.liveBytes;
+    if (stats != NULL)
+    {
+        *stats = k_heap.stats;
+    }
+
+    if (limits != NULL)
+    {
+        checkLimit(ASSERT_RECORD(), k_heap.stats.allocCount, limits->maxAllocCount);
+        checkLimit(ASSERT_RECORD(), k_heap.stats.allocBytes, limits->maxAllocBytes);
+        checkLimit(ASSERT_RECORD(), k_heap.stats.peakBytes, limits->maxPeakBytes);
+        checkLimit(ASSERT_RECORD(), k_heap.stats.leakedBytes, limits->maxLeakedBytes);
+    }
+}
+
+#else
+
+// Heap tracking disabled - allocation API is a pass-through.
+
+static void trackAlloc(uintptr_t addr, size_t size)
+{
+    (void)addr;
+    (void)size;
+}
+
+static void trackFree(uintptr_t addr) { (void)addr; }
+
+#endif // defined(RSTEST_HEAP_TRACKING)
+
+// ------------------------------------------------------------------
+// Hooks
+
+void rstest_heapOnAlloc(const void *ptr, size_t size) { trackAlloc((uintptr_t)ptr, size); }
+
+void rstest_heapOnFree(const void *ptr) { trackFree((uintptr_t)ptr); }
+
+// ------------------------------------------------------------------
+// Allocation API
+
+void *rstest_malloc(size_t size)
+{
+    void *ptr = RAW_MALLOC(size);
+    trackAlloc((uintptr_t)ptr, size);
+    return ptr;
+}
+
+void *rstest_calloc(size_t num, size_t size)
+{
+    void *ptr = RAW_CALLOC(num, size);
+    trackAlloc((uintptr_t)ptr, num * size);
+    return ptr;
+}
+
+void *rstest_realloc(void *ptr, size_t size)
+{
+    const uintptr_t addr   = (uintptr_t)ptr;
+    void           *newPtr = RAW_REALLOC(ptr, size);
+    // On failure the original allocation is untouched.
+    if ((newPtr != NULL) || (size == 0U))
+    {
+        trackFree(addr);
+        trackAlloc((uintptr_t)newPtr, size);
+    }
+    return newPtr;
+}
+
+void rstest_free(void *ptr)
+{
+    trackFree((uintptr_t)ptr);
+    RAW_FREE(ptr);
+}
+
+#if defined(RSTEST_HEAP_WRAP)
+
+// Declarations to satisfy missing prototype checks.
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t num, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+void  __wrap_free(void *ptr);
+
+void *__wrap_malloc(size_t size) { return rstest_malloc(size); }
+
+void *__wrap_calloc(size_t num, size_t size) { return rstest_calloc(num, size); }
+
+void *__wrap_realloc(void *ptr, size_t size) { return rstest_realloc(ptr, size); }
+
+void __wrap_free(void *ptr) { rstest_free(ptr); }
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // defined(RSTEST_HEAP_WRAP)
@@ -19,22 +19,171 @@
 // SOFTWARE.
 //
 ///
-/// @brief Minimal Test Framwork for creating test cases.
+/// @brief Really Small Test Framwork internal interface shared between the
+/// framework translation units (not part of the api).
 //
 #pragma once
 
-#include "rstest_framework.h"
+#include "rstest/rstest.h"
+#include "rstest/rstest_budget.h"
+#include "rstest/rstest_checkpoint.h"
 
-/// Test Suite State
-/// @startuml Test Suite State
-/// [*]        -d-> NotReady
-/// NotReady   -d-> Ready : rstest_init()
-/// Executing  -d-> Pass      : END_TESTCASE_PASS()
-/// Executing  -d-> Fail      : ASSERT_TRUE(false) | END_TESTCASE_FAIL()
-/// @enduml 'Test Case State
-typedef enum TestSuiteState_e
+#if defined(__cplusplus)
+extern "C"
 {
-    NotReady = 0, ///< Not Initialized
-    Ready    = 1, ///< Initialized
-    Complete = 2, ///< Completed
-} TestSuiteState_t;
+#endif
+
+    /// Add an assertion record to the appropriate list.
+    /// If it is a failure change the state of the current test case and
+    /// execute the failure callback.
+    /// @param[in] rec assertion record
+    /// @param[in] cond condition of the assertion
+    /// @pre Test Suite is running a test case.
+    void rstest_addAssertion(const AssertRecord_t *rec, bool cond);
+
+    /// Abort on the first failure instead of continuing the test case.
+    /// Used when fuzzing so a failure is reported as a crash.
+    /// @param[in] enable true to abort on failure
+    void rstest_setAbortOnFailure(bool enable);
+
+    /// Execute a single parameter of a parameterized test case.
+    /// Executes the startup callback, the test case with the parameter and the
+    /// teardown callback outside of rstest_run(). Report counters are not updated.
+    /// @param[in] caseIndex index of the test case within the TestSuite
+    /// @param[in] param pointer to the parameter (sized paramSize of the test case)
+    /// @pre rstest_init() succeeded.
+    /// @returns Pass or Fail state of the test case, or Disabled if it was not executed
+    ///     (not initialized, not a parameterized or a disabled test case).
+    TestCaseState_t rstest_executeParam(size_t caseIndex, const void *param);
+
+    /// Release the test suite - nothing refers to it afterwards (e.g. its plugin is unloaded).
+    /// The report is cleared, the test suite must be initialized again to run.
+    void rstest_release(void);
+
+    /// Index of the current test case of the running test suite.
+    /// @returns the index within the TestSuite, UINT32_MAX when the test suite is not running
+    uint32_t rstest_currentCase(void);
+
+    /// A dataset was generated or taken from a cache for the current test case.
+    /// @param[in] seed seed of the dataset, kept as the dataSeed of the test case result
+    void rstest_dataUsed(uint64_t seed);
+
+    /// Is a checkpoint store set?
+    /// @retval true when rstest_run() writes checkpoints
+    bool rstest_checkpointEnabled(void);
+
+    /// Write a checkpoint to the store - the magic and CRC are filled in.
+    /// @param[in,out] checkpoint checkpoint to write
+    /// @pre rstest_checkpointEnabled()
+    void rstest_checkpointSave(TestCheckpoint_t *checkpoint);
+
+    /// Read a valid checkpoint from the store.
+    /// @param[out] checkpoint checkpoint read
+    /// @retval true when read with the magic and a matching CRC
+    /// @retval false otherwise (no store)
+    bool rstest_checkpointLoad(TestCheckpoint_t *checkpoint);
+
+    /// Add a string to a hash (FNV-1a).
+    /// @param[in] hash hash so far, 0 to start
+    /// @param[in] str string to add (NULL adds an empty string)
+    /// @returns the hash
+    uint32_t rstest_checkpointHash(uint32_t hash, const char *str);
+
+    /// Execution order of a time budgeted run - highest priority score first.
+    /// @param[in] testSuite test suite, at most RSTEST_BUDGET_MAX_CASES test cases
+    /// @param[in] history stored results of the previous runs (may be NULL)
+    /// @param[out] order index of the test case at each position
+    /// @param[out] expected expected duration of each test case (0 when unknown)
+    void rstest_budgetOrder(const TestSuite_t *testSuite, const TestHistory_t *history, uint32_t *order,
+                            uint64_t *expected);
+
+    /// Status block - a test suite run started.
+    /// @param[in] suiteName name of the test suite
+    /// @param[in] caseCount count of test cases (all Idle)
+    void rstest_statusBegin(const char *suiteName, size_t caseCount);
+
+    /// Status block - a test case changed state.
+    /// @param[in] caseIndex index of the test case within the TestSuite
+    /// @param[in] name name of the test case
+    /// @param[in] from state the test case is counted in
+    /// @param[in] to state the test case is now counted in
+    void rstest_statusCase(size_t caseIndex, const char *name, TestCaseState_t from, TestCaseState_t to);
+
+    /// Status block - a failing assertion.
+    /// @param[in] caseIndex index of the failing test case within the TestSuite
+    /// @param[in] rec failing assertion record
+    void rstest_statusFailure(size_t caseIndex, const AssertRecord_t *rec);
+
+    /// Status block - the test suite run completed.
+    void rstest_statusEnd(void);
+
+    /// Log - discard the entries of the previous test cases.
+    void rstest_logBegin(void);
+
+    /// Log - a test case completed, the entries of a failed test case are kept.
+    /// @param[in] caseIndex index of the test case within the TestSuite
+    /// @param[in] failed true when the test case failed
+    void rstest_logEnd(uint32_t caseIndex, bool failed);
+
+    /// Log - discard every entry, including the failure entries (their test suite is released).
+    void rstest_logDiscard(void);
+
+    /// Trace - discard every event (their test suite is released).
+    void rstest_traceDiscard(void);
+
+#if defined(RSTEST_HEAP_TRACKING)
+    /// Start tracking heap allocations for the current test case.
+    void rstest_heapBegin(void);
+
+    /// Stop tracking heap allocations for the current test case and check limits.
+    /// @param[out] stats heap statistics of the current test case (may be NULL)
+    /// @param[in] limits heap limits to check against (may be NULL for no limits)
+    void rstest_heapEnd(TestHeapStats_t *stats, const TestHeapLimits_t *limits);
+#endif // defined(RSTEST_HEAP_TRACKING)
+
+#if defined(RSTEST_PERF_COUNTERS)
+    /// Start counting performance counters for the current test case - counters are reset and paused.
+    void rstest_perfBegin(void);
+
+    /// Resume the performance counters - the test case body starts executing.
+    void rstest_perfResume(void);
+
+    /// Pause the performance counters - the test case body completed.
+    void rstest_perfPause(void);
+
+    /// Stop counting performance counters for the current test case and check limits.
+    /// @param[out] stats performance counters of the current test case (may be NULL)
+    /// @param[in] limits performance limits to check against (may be NULL for no limits)
+    void rstest_perfEnd(TestPerfStats_t *stats, const TestPerfLimits_t *limits);
+#endif // defined(RSTEST_PERF_COUNTERS)
+
+#if defined(RSTEST_STACK_USAGE)
+    /// Execute the current test case on the stack region and measure its stack usage.
+    /// Without a stack (NULL, no region or no run callback) the function executes on the current stack.
+    /// @param[in] func function executing the test case
+    /// @param[in] arg argument of the function
+    /// @param[out] stats stack usage of the current test case (may be NULL)
+    /// @param[in] stack stack to execute on and its limit (may be NULL)
+    void rstest_stackRun(TestStackFunc_t func, void *arg, TestStackStats_t *stats, const TestStack_t *stack);
+#endif // defined(RSTEST_STACK_USAGE)
+
+#if defined(RSTEST_COVERAGE_MAP)
+    /// Start recording coverage for a test suite.
+    /// @param[in] caseCount count of test cases of the test suite
+    void rstest_coverageStart(size_t caseCount);
+
+    /// Start recording coverage for a test case - its previous coverage is cleared.
+    /// @param[in] caseIndex index of the test case within the TestSuite
+    void rstest_coverageBegin(size_t caseIndex);
+
+    /// Resume recording coverage for a test case (async test case resumed).
+    /// @param[in] caseIndex index of the test case within the TestSuite
+    void rstest_coverageResume(size_t caseIndex);
+
+    /// Pause recording coverage - no test case is executing.
+    void rstest_coveragePause(void);
+#endif // defined(RSTEST_COVERAGE_MAP)
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,128 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork deferred binary logging.
+//
+
+#include "rstest/rstest_log.h"
+#include "rstest_internal.h"
+
+/// Reserve the next entry of the log - atomic so stress workers need no lock.
+#if defined(__GNUC__) || defined(__clang__)
+#define LOG_RESERVE(log) __atomic_fetch_add(&((log)->head), 1U, __ATOMIC_RELAXED)
+#else
+#define LOG_RESERVE(log) ((log)->head++)
+#endif
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Log recorded while running (NULL when none).
+static TestLog_t *k_log = NULL;
+
+// ------------------------------------------------------------------
+// Log API
+
+bool rstest_setLog(TestLog_t *log)
+{
+    if ((log != NULL) && ((log->capacity == 0U) || ((log->capacity & (log->capacity - 1U)) != 0U)))
+    {
+        k_log = NULL;
+        return false;
+    }
+    k_log = log;
+    if (k_log != NULL)
+    {
+        k_log->head      = 0U;
+        k_log->failCount = 0U;
+    }
+    return true;
+}
+
+void rstest_log(const char *fmt, uintptr_t a0, uintptr_t a1, uintptr_t a2, uintptr_t a3)
+{
+    TestLog_t *log = k_log;
+    if (log == NULL)
+    {
+        return;
+    }
+    const uint32_t caseIndex = rstest_currentCase();
+    if (caseIndex == RSTEST_LOG_NO_CASE)
+    {
+        return;
+    }
+    TestLogEntry_t *entry = &(log->entries[LOG_RESERVE(log) & (log->capacity - 1U)]);
+    entry->fmt       = fmt;
+    entry->args[0]   = a0;
+    entry->args[1]   = a1;
+    entry->args[2]   = a2;
+    entry->args[3]   = a3;
+    entry->caseIndex = caseIndex;
+}
+
+uint32_t rstest_logFailCount(const TestLog_t *log)
+{
+    return (log->failCount < log->failCapacity) ? log->failCount : log->failCapacity;
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_logBegin(void)
+{
+    if (k_log != NULL)
+    {
+        k_log->head = 0U;
+    }
+}
+
+void rstest_logEnd(uint32_t caseIndex, bool failed)
+{
+    TestLog_t *log = k_log;
+    if ((log == NULL) || !failed)
+    {
+        return;
+    }
+    // Keep the entries of the failed test case, oldest first.
+    const uint32_t count = (log->head < log->capacity) ? log->head : log->capacity;
+    for (uint32_t idx = 0U; idx < count; idx++)
+    {
+        const TestLogEntry_t *entry = &(log->entries[(log->head - count + idx) & (log->capacity - 1U)]);
+        if (entry->caseIndex != caseIndex)
+        {
+            continue;
+        }
+        if (log->failCount < log->failCapacity)
+        {
+            log->failEntries[log->failCount] = *entry;
+        }
+        log->failCount++;
+    }
+}
+
+void rstest_logDiscard(void)
+{
+    if (k_log != NULL)
+    {
+        k_log->head      = 0U;
+        k_log->failCount = 0U;
+    }
+}
@@ -0,0 +1,197 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork deferred binary logging formatter (host only).
+//
+
+#include "rstest/rstest_log.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Format a single conversion with its argument word.
+/// @param[in] spec conversion specification ('%' to the conversion character, terminated)
+/// @param[in] length length modifier of the conversion
+/// @param[in] conversion conversion character
+/// @param[in] word raw argument word
+/// @param[out] buf buffer for the conversion
+/// @param[in] size size of buf
+/// @returns the length of the conversion (as snprintf())
+static int formatArg(const char *spec, const char *length, char conversion, uintptr_t word, char *buf, size_t size)
+{
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wformat-nonliteral"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif
+    int len = 0;
+    switch (conversion)
+    {
+    case 'd':
+    case 'i':
+        if ((strcmp(length, "l") == 0) || (strcmp(length, "ll") == 0) || (strcmp(length, "j") == 0) ||
+            (strcmp(length, "z") == 0) || (strcmp(length, "t") == 0))
+        {
+            len = snprintf(buf, size, spec, (long long)(intptr_t)word);
+        }
+        else
+        {
+            len = snprintf(buf, size, spec, (int)(intptr_t)word);
+        }
+        break;
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+        if ((strcmp(length, "l") == 0) || (strcmp(length, "ll") == 0) || (strcmp(length, "j") == 0) ||
+            (strcmp(length, "z") == 0) || (strcmp(length, "t") == 0))
+        {
+            len = snprintf(buf, size, spec, (unsigned long long)word);
+        }
+        else
+        {
+            len = snprintf(buf, size, spec, (unsigned)word);
+        }
+        break;
+    case 'c':
+        len = snprintf(buf, size, spec, (int)word);
+        break;
+    case 's':
+        len = snprintf(buf, size, spec, (word != 0U) ? (const char *)word : "(null)");
+        break;
+    case 'p':
+        len = snprintf(buf, size, spec, (void *)word);
+        break;
+    default:
+        // Floating point and the other conversions are not supported.
+        len = snprintf(buf, size, "%s", "?");
+        break;
+    }
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+    return len;
+}
+
+// ------------------------------------------------------------------
+// Log API
+
+size_t rstest_logFormat(const TestLogEntry_t *entry, char *buf, size_t size)
+{
+    const char *fmt    = (entry->fmt != NULL) ? entry->fmt : "";
+    size_t      out    = 0U;
+    uint32_t    argIdx = 0U;
+
+    while (*fmt != '\0')
+    {
+        char        *dst  = (out < size) ? &(buf[out]) : NULL;
+        const size_t room = (out < size) ? (size - out) : 0U;
+        if ((fmt[0] != '%') || (fmt[1] == '%') || (fmt[1] == '\0'))
+        {
+            // Literal text (or an escaped '%').
+            if (room > 1U)
+            {
+                *dst = *fmt;
+            }
+            out++;
+            fmt += ((fmt[0] == '%') && (fmt[1] == '%')) ? 2 : 1;
+            continue;
+        }
+
+        // Conversion - flags, width and precision (digits only), length modifier and conversion.
+        const char *start = fmt++;
+        fmt += strspn(fmt, "-+ #0");
+        fmt += strspn(fmt, "0123456789");
+        if (*fmt == '.')
+        {
+            fmt++;
+            fmt += strspn(fmt, "0123456789");
+        }
+        const char  *lengthStart = fmt;
+        const size_t lengthLen   = strspn(fmt, "hljzt");
+        fmt += lengthLen;
+        const char conversion = *fmt;
+        if (conversion == '\0')
+        {
+            break;
+        }
+        fmt++;
+
+        char            spec[32];
+        char            length[4] = {0};
+        const size_t    specLen   = (size_t)(fmt - start);
+        const uintptr_t word      = (argIdx < RSTEST_LOG_MAX_ARGS) ? entry->args[argIdx] : 0U;
+        argIdx++;
+        int len = 0;
+        if ((specLen >= sizeof(spec)) || (lengthLen >= sizeof(length)))
+        {
+            len = snprintf(dst, room, "%s", "?");
+        }
+        else
+        {
+            (void)memcpy(spec, start, specLen);
+            spec[specLen] = '\0';
+            (void)memcpy(length, lengthStart, lengthLen);
+            len = formatArg(spec, length, conversion, word, dst, room);
+        }
+        out += (len > 0) ? (size_t)len : 0U;
+    }
+    if (size != 0U)
+    {
+        buf[(out < size) ? out : (size - 1U)] = '\0';
+    }
+    return out;
+}
+
+bool rstest_logExport(const TestLog_t *log, const TestSuite_t *testSuite, const char *path)
+{
+    FILE *stream = fopen(path, "w");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    const uint32_t count = rstest_logFailCount(log);
+    bool           ok    = true;
+    for (uint32_t idx = 0U; ok && (idx < count); idx++)
+    {
+        const TestLogEntry_t *entry = &(log->failEntries[idx]);
+        const char           *name  = ((testSuite != NULL) && (entry->caseIndex < testSuite->count))
+                                          ? testSuite->testCases[entry->caseIndex].name
+                                          : "?";
+        char message[256];
+        (void)rstest_logFormat(entry, message, sizeof(message));
+        ok = (fprintf(stream, "%s: %s\n", name, message) > 0);
+    }
+    if (ok && (log->failCount > count))
+    {
+        ok = (fprintf(stream, "... %u entries dropped\n", (unsigned)(log->failCount - count)) > 0);
+    }
+    ok = (fclose(stream) == 0) && ok;
+    return ok;
+}
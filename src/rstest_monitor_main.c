@@ -0,0 +1,127 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork live status monitor (host only).
+/// Polls a status block file written by a running test suite (see
+/// rstest_statusMapFile()) without stopping it and prints its progress:
+///     rstest_monitor <status file> [poll period ms]
+/// Exits once the test suite run completes - failure if any test case failed
+/// (an assertion failed or it never ended) or was blocked.
+/// A poll period of 0 prints the current status once.
+//
+
+#define _POSIX_C_SOURCE 200809L // nanosleep
+
+#include "rstest/rstest_status.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/// Default poll period in ms
+#define MONITOR_POLL_MS (500L)
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Print a status block.
+/// @param[in] status consistent copy of the status block
+static void printStatus(const TestStatus_t *status)
+{
+    const uint32_t done = status->stateCount[TestCaseState_Disabled] + status->stateCount[TestCaseState_Pass] +
+                          status->stateCount[TestCaseState_Fail] + status->stateCount[TestCaseState_Blocked] +
+                          status->stateCount[TestCaseState_Deferred];
+    (void)printf("[%u] %s %s %u/%u pass:%u fail:%u blocked:%u deferred:%u disabled:%u executing:%u",
+                 (unsigned)status->sequence, status->suiteName, (status->running != 0U) ? "running" : "complete",
+                 (unsigned)done, (unsigned)status->caseCount, (unsigned)status->stateCount[TestCaseState_Pass],
+                 (unsigned)status->stateCount[TestCaseState_Fail], (unsigned)status->stateCount[TestCaseState_Blocked],
+                 (unsigned)status->stateCount[TestCaseState_Deferred],
+                 (unsigned)status->stateCount[TestCaseState_Disabled],
+                 (unsigned)status->stateCount[TestCaseState_Executing]);
+    if (status->caseIndex != RSTEST_STATUS_NO_CASE)
+    {
+        (void)printf(" case:%u %s", (unsigned)status->caseIndex, status->caseName);
+    }
+    if (status->failAssertCount != 0U)
+    {
+        (void)printf(" last failure: case %u %s:%u", (unsigned)status->lastFailure.caseIndex,
+                     status->lastFailure.file, (unsigned)status->lastFailure.line);
+        if (status->lastFailure.param != RSTEST_NO_PARAM)
+        {
+            (void)printf(" param %u", (unsigned)status->lastFailure.param);
+        }
+    }
+    (void)printf("\n");
+    (void)fflush(stdout);
+}
+
+/// Sleep for the poll period.
+/// @param[in] periodMs poll period in ms
+static void pollSleep(long periodMs)
+{
+    const struct timespec period = {periodMs / 1000L, (periodMs % 1000L) * 1000000L};
+    (void)nanosleep(&period, NULL);
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc < 2) || (argc > 3))
+    {
+        (void)fprintf(stderr, "Usage: %s <status file> [poll period ms]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const long periodMs = (argc == 3) ? strtol(argv[2], NULL, 10) : MONITOR_POLL_MS;
+
+    TestStatus_t *mapped = rstest_statusMapFile(argv[1], false);
+    if (mapped == NULL)
+    {
+        (void)fprintf(stderr, "Unable to map: %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    TestStatus_t status;
+    uint32_t     sequence = 1U; // Never a valid (even) sequence.
+    int          result   = EXIT_FAILURE;
+    for (;;)
+    {
+        if (rstest_statusRead(mapped, &status) && (status.sequence != sequence))
+        {
+            sequence = status.sequence;
+            printStatus(&status);
+            if ((status.running == 0U) && (status.runCount != 0U))
+            {
+                result = ((status.failAssertCount == 0U) && (status.stateCount[TestCaseState_Fail] == 0U) &&
+                          (status.stateCount[TestCaseState_Blocked] == 0U))
+                             ? EXIT_SUCCESS
+                             : EXIT_FAILURE;
+                break;
+            }
+        }
+        if (periodMs <= 0L)
+        {
+            break;
+        }
+        pollSleep(periodMs);
+    }
+
+    rstest_statusUnmapFile(mapped);
+    return result;
+}
@@ -0,0 +1,197 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork hardware performance counters
+/// (Linux host only, perf_event_open).
+//
+
+#define _DEFAULT_SOURCE // syscall
+
+#include "rstest/rstest_perf.h"
+#include "rstest_internal.h"
+
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+/// Performance counters info
+typedef struct PerfInfo_s
+{
+    int  fds[RSTEST_PERF_COUNTER_COUNT]; ///< Counter file descriptors, -1 when unavailable
+    bool opened;                         ///< Counters opened (once per process)
+} PerfInfo_t;
+
+/// Counter read with the time enabled and running (PERF_FORMAT_TOTAL_TIME_*).
+typedef struct PerfRead_s
+{
+    uint64_t value;   ///< Count while running
+    uint64_t enabled; ///< Time enabled
+    uint64_t running; ///< Time running - less than enabled when multiplexed
+} PerfRead_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Hardware events of the counters - indexed by TestPerfCounter_t.
+static const uint64_t k_events[RSTEST_PERF_COUNTER_COUNT] = {PERF_COUNT_HW_CPU_CYCLES,
+                                                             PERF_COUNT_HW_INSTRUCTIONS,
+                                                             PERF_COUNT_HW_CACHE_REFERENCES,
+                                                             PERF_COUNT_HW_CACHE_MISSES,
+                                                             PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+                                                             PERF_COUNT_HW_BRANCH_MISSES};
+
+// Performance counters (Singleton)
+static PerfInfo_t k_perf = {{0}, false};
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Open the counters of the calling thread, user space only so no privilege
+/// is needed beyond the default perf_event_paranoid.
+static void openCounters(void)
+{
+    for (size_t idx = 0U; idx < RSTEST_PERF_COUNTER_COUNT; idx++)
+    {
+        struct perf_event_attr attr;
+        (void)memset(&attr, 0, sizeof(attr));
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = k_events[idx];
+        attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.disabled       = 1U;
+        attr.exclude_kernel = 1U;
+        attr.exclude_hv     = 1U;
+        k_perf.fds[idx]     = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0UL);
+    }
+    k_perf.opened = true;
+}
+
+/// Control every available counter.
+/// @param[in] request PERF_EVENT_IOC_* request
+static void controlCounters(unsigned long request)
+{
+    for (size_t idx = 0U; idx < RSTEST_PERF_COUNTER_COUNT; idx++)
+    {
+        if (k_perf.fds[idx] >= 0)
+        {
+            (void)ioctl(k_perf.fds[idx], request, 0);
+        }
+    }
+}
+
+/// Check a minimum ratio limit and fail the current test case if below.
+/// @param[in] rec assertion record identifying the limit
+/// @param[in] stats counted performance counters
+/// @param[in] num numerator counter
+/// @param[in] den denominator counter
+/// @param[in] limit minimum permille, RSTEST_PERF_UNLIMITED for none
+static void checkMinRatio(const AssertRecord_t *rec, const TestPerfStats_t *stats, TestPerfCounter_t num,
+                          TestPerfCounter_t den, uint32_t limit)
+{
+    const uint32_t both = (1U << num) | (1U << den);
+    if ((limit != RSTEST_PERF_UNLIMITED) && ((stats->valid & both) == both) && (stats->counts[den] != 0U) &&
+        (((stats->counts[num] * 1000U) / stats->counts[den]) < limit))
+    {
+        rstest_addAssertion(rec, false);
+    }
+}
+
+/// Check a maximum ratio limit and fail the current test case if exceeded.
+/// @param[in] rec assertion record identifying the limit
+/// @param[in] stats counted performance counters
+/// @param[in] num numerator counter
+/// @param[in] den denominator counter
+/// @param[in] limit maximum permille, RSTEST_PERF_UNLIMITED for none
+static void checkMaxRatio(const AssertRecord_t *rec, const TestPerfStats_t *stats, TestPerfCounter_t num,
+                          TestPerfCounter_t den, uint32_t limit)
+{
+    const uint32_t both = (1U << num) | (1U << den);
+    if ((limit != RSTEST_PERF_UNLIMITED) && ((stats->valid & both) == both) && (stats->counts[den] != 0U) &&
+        (((stats->counts[num] * 1000U) / stats->counts[den]) > limit))
+    {
+        rstest_addAssertion(rec, false);
+    }
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_perfBegin(void)
+{
+    if (!k_perf.opened)
+    {
+        openCounters();
+    }
+    controlCounters(PERF_EVENT_IOC_RESET);
+}
+
+void rstest_perfResume(void) { controlCounters(PERF_EVENT_IOC_ENABLE); }
+
+void rstest_perfPause(void) { controlCounters(PERF_EVENT_IOC_DISABLE); }
+
+void rstest_perfEnd(TestPerfStats_t *stats, const TestPerfLimits_t *limits)
+{
+    TestPerfStats_t counted = {{0}, 0U};
+    for (size_t idx = 0U; idx < RSTEST_PERF_COUNTER_COUNT; idx++)
+    {
+        PerfRead_t counter = {0U, 0U, 0U};
+        if ((k_perf.fds[idx] < 0) || (read(k_perf.fds[idx], &counter, sizeof(counter)) != (ssize_t)sizeof(counter)) ||
+            (counter.running == 0U))
+        {
+            continue;
+        }
+        // Scale a multiplexed counter to the whole time enabled.
+        counted.counts[idx] = (counter.running < counter.enabled)
+                                  ? (uint64_t)(((double)counter.value * (double)counter.enabled) / (double)counter.running)
+                                  : counter.value;
+        counted.valid |= (1U << idx);
+    }
+    if (stats != NULL)
+    {
+        *stats = counted;
+    }
+
+    if (limits != NULL)
+    {
+        checkMinRatio(ASSERT_RECORD(), &counted, TestPerfCounter_Instructions, TestPerfCounter_Cycles,
+                      limits->minIpcPermille);
+        checkMaxRatio(ASSERT_RECORD(), &counted, TestPerfCounter_CacheMisses, TestPerfCounter_CacheReferences,
+                      limits->maxCacheMissPermille);
+        checkMaxRatio(ASSERT_RECORD(), &counted, TestPerfCounter_BranchMisses, TestPerfCounter_BranchInstructions,
+                      limits->maxBranchMissPermille);
+        if ((limits->maxCycles != RSTEST_PERF_UNLIMITED) && ((counted.valid & (1U << TestPerfCounter_Cycles)) != 0U) &&
+            (counted.counts[TestPerfCounter_Cycles] > limits->maxCycles))
+        {
+            rstest_addAssertion(ASSERT_RECORD(), false);
+        }
+    }
+}
@@ -0,0 +1,54 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork test suite plugins - merged report.
+//
+
+#include "rstest/rstest_plugin.h"
+
+#include <stddef.h>
+
+// ------------------------------------------------------------------
+// Plugin API
+
+void rstest_pluginMerge(TestPluginReport_t *merged, const TestReport_t *report, bool passed)
+{
+    merged->suiteCount++;
+    if (report == NULL)
+    {
+        merged->suiteFailCount++;
+        return;
+    }
+    merged->suiteFailCount += passed ? 0U : 1U;
+    merged->testCount += report->testCount;
+    merged->disabledCount += report->disabledCount;
+    merged->executedCount += report->executedCount;
+    merged->passCount += report->passCount;
+    merged->failCount += report->failCount;
+    merged->blockedCount += report->blockedCount;
+    merged->deferredCount += report->deferredCount;
+    merged->passAssertCount += report->passAssertCount;
+}
+
+bool rstest_pluginPassed(const TestPluginReport_t *merged)
+{
+    return (merged->loadFailCount == 0U) && (merged->suiteCount != 0U) && (merged->suiteFailCount == 0U);
+}
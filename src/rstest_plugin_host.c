@@ -0,0 +1,70 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork test suite plugins of a host (dlopen).
+//
+
+#include "rstest/rstest_plugin.h"
+#include "rstest_internal.h"
+
+#include <dlfcn.h>
+#include <stddef.h>
+
+// ------------------------------------------------------------------
+// Plugin API
+
+bool rstest_pluginRun(const char *path, TestPluginReport_t *merged, TestPluginSuiteCb_t suiteCb, void *user)
+{
+    // Every symbol resolved now - an undefined symbol fails the load rather than the test case.
+    void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (handle == NULL)
+    {
+        merged->loadFailCount++;
+        return false;
+    }
+
+    const TestPlugin_t *plugin = (const TestPlugin_t *)dlsym(handle, RSTEST_PLUGIN_SYMBOL);
+    if ((plugin == NULL) || (plugin->version != RSTEST_PLUGIN_VERSION))
+    {
+        (void)dlclose(handle);
+        merged->loadFailCount++;
+        return false;
+    }
+
+    merged->pluginCount++;
+    for (uint32_t idx = 0U; idx < plugin->count; idx++)
+    {
+        const bool          ready  = rstest_init(plugin->suites[idx]) && rstest_run();
+        const TestReport_t *report = ready ? rstest_getReport() : NULL;
+        rstest_pluginMerge(merged, report, ready && rstest_testSuitePassed());
+        if (suiteCb != NULL)
+        {
+            suiteCb(path, plugin->suites[idx], report, user);
+        }
+        // Names and format strings of the entries are in the plugin.
+        rstest_traceDiscard();
+        rstest_logDiscard();
+    }
+
+    rstest_release();
+    (void)dlclose(handle);
+    return true;
+}
@@ -0,0 +1,89 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork test suite plugin runner (host only).
+/// Loads each test suite plugin (see RSTEST_PLUGIN_EXPORT()), runs its test
+/// suites and prints their results and the merged report:
+///     rstest_plugin <plugin.so>...
+/// Exits with failure unless every plugin loaded and every test suite passed.
+//
+
+#include "rstest/rstest_plugin.h"
+
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Print the result of a test suite and its failing assertions.
+/// @param[in] path path of the plugin
+/// @param[in] testSuite unused
+/// @param[in] report report of the test suite, NULL when it could not be initialized
+/// @param[in] user unused
+static void printSuite(const char *path, const TestSuite_t *testSuite, const TestReport_t *report, void *user)
+{
+    (void)testSuite;
+    (void)user;
+    if (report == NULL)
+    {
+        (void)printf("%s: unable to initialize a test suite\n", path);
+        return;
+    }
+    (void)printf("%s: %s executed:%u pass:%u fail:%u blocked:%u deferred:%u disabled:%u\n", path,
+                 (report->name != NULL) ? report->name : "", (unsigned)report->executedCount,
+                 (unsigned)report->passCount, (unsigned)report->failCount, (unsigned)report->blockedCount,
+                 (unsigned)report->deferredCount, (unsigned)report->disabledCount);
+    for (size_t idx = 0U; idx < report->failAsserts.count; idx++)
+    {
+        const AssertRecord_t *rec = &(report->failAsserts.records[idx]);
+        (void)printf("  failure %s:%u\n", (rec->file != NULL) ? rec->file : "", (unsigned)rec->line);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        (void)fprintf(stderr, "Usage: %s <plugin.so>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    TestPluginReport_t merged = {0};
+    for (int idx = 1; idx < argc; idx++)
+    {
+        if (!rstest_pluginRun(argv[idx], &merged, &printSuite, NULL))
+        {
+            const char *error = dlerror();
+            (void)fprintf(stderr, "Unable to load: %s %s\n", argv[idx],
+                          (error != NULL) ? error : "no " RSTEST_PLUGIN_SYMBOL " of this version");
+        }
+    }
+
+    (void)printf("plugins:%u (load failed:%u) suites:%u (failed:%u) executed:%u pass:%u fail:%u blocked:%u "
+                 "deferred:%u disabled:%u asserts:%u\n",
+                 (unsigned)merged.pluginCount, (unsigned)merged.loadFailCount, (unsigned)merged.suiteCount,
+                 (unsigned)merged.suiteFailCount, (unsigned)merged.executedCount, (unsigned)merged.passCount,
+                 (unsigned)merged.failCount, (unsigned)merged.blockedCount, (unsigned)merged.deferredCount,
+                 (unsigned)merged.disabledCount, (unsigned)merged.passAssertCount);
+    return rstest_pluginPassed(&merged) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
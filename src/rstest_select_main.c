@@ -0,0 +1,61 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork change based test case selection (host only).
+/// Prints the names of the test cases of a coverage map (see
+/// rstest_coverageSave()) that executed a line changed by a unified diff:
+///     git diff -U0 | rstest_select <coverage map> [diff file]
+/// The diff is read from stdin without a diff file.
+//
+
+#include "rstest/rstest_coverage.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Print a selected test case.
+/// @param[in] name name of the test case
+/// @param[in] user unused
+static void printCase(const char *name, void *user)
+{
+    (void)user;
+    (void)printf("%s\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    if ((argc < 2) || (argc > 3))
+    {
+        (void)fprintf(stderr, "Usage: %s <coverage map> [diff file]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char *diffPath = (argc == 3) ? argv[2] : "/dev/stdin";
+    if (!rstest_coverageSelect(argv[1], diffPath, printCase, NULL))
+    {
+        (void)fprintf(stderr, "Unable to select from: %s %s\n", argv[1], diffPath);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
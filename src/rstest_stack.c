@@ -0,0 +1,109 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork stack usage measurement.
+//
+
+#include "rstest/rstest_stack.h"
+#include "rstest_internal.h"
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Whole aligned words of a stack region.
+/// @param[in] region lowest address of the stack region
+/// @param[in] size size of the stack region in bytes
+/// @param[out] first address of the first whole word
+/// @returns the count of whole words
+static size_t regionWords(const void *region, size_t size, uintptr_t *first)
+{
+    const uintptr_t start = (uintptr_t)region;
+    const uintptr_t end   = start + size;
+    *first                = (start + (sizeof(uint32_t) - 1U)) & ~(uintptr_t)(sizeof(uint32_t) - 1U);
+    return (end > *first) ? (size_t)((end - *first) / sizeof(uint32_t)) : 0U;
+}
+
+// ------------------------------------------------------------------
+// Stack API
+
+void rstest_stackPaint(void *region, size_t size)
+{
+    uintptr_t          first = 0U;
+    const size_t       count = regionWords(region, size, &first);
+    volatile uint32_t *words = (volatile uint32_t *)first;
+    for (size_t idx = 0U; idx < count; idx++)
+    {
+        words[idx] = RSTEST_STACK_PAINT;
+    }
+}
+
+size_t rstest_stackUsed(const void *region, size_t size)
+{
+    uintptr_t                first = 0U;
+    const size_t             count = regionWords(region, size, &first);
+    const volatile uint32_t *words = (const volatile uint32_t *)first;
+    size_t                   idx   = 0U;
+    // Stack grows down - the untouched paint is at the low end.
+    while ((idx < count) && (words[idx] == RSTEST_STACK_PAINT))
+    {
+        idx++;
+    }
+    return (count - idx) * sizeof(uint32_t);
+}
+
+#if defined(RSTEST_STACK_USAGE)
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_stackRun(TestStackFunc_t func, void *arg, TestStackStats_t *stats, const TestStack_t *stack)
+{
+    TestStackStats_t measured = {0U, 0U};
+    if ((stack == NULL) || (stack->region == NULL) || (stack->runCb == NULL))
+    {
+        func(arg);
+    }
+    else
+    {
+        rstest_stackPaint(stack->region, stack->size);
+        stack->runCb(stack->region, stack->size, func, arg, stack->runCbUser);
+        measured.usedBytes = rstest_stackUsed(stack->region, stack->size);
+        measured.sizeBytes = stack->size;
+
+        uintptr_t    first  = 0U;
+        const size_t usable = regionWords(stack->region, stack->size, &first) * sizeof(uint32_t);
+        if ((measured.usedBytes + RSTEST_STACK_GUARD) > usable)
+        {
+            // The guard was written - overflowed (memory below the region is likely corrupt).
+            rstest_addAssertion(ASSERT_RECORD(), false);
+        }
+        else if (measured.usedBytes > stack->maxUsedBytes)
+        {
+            rstest_addAssertion(ASSERT_RECORD(), false);
+        }
+    }
+    if (stats != NULL)
+    {
+        *stats = measured;
+    }
+}
+
+#endif // defined(RSTEST_STACK_USAGE)
@@ -0,0 +1,67 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork stack run callback of a host (ucontext).
+//
+
+#define _XOPEN_SOURCE 600 // ucontext
+
+#include "rstest/rstest_stack.h"
+
+#include <ucontext.h>
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Context returned to when the function completes.
+static ucontext_t k_caller;
+// Context executing the function on the stack region.
+static ucontext_t k_callee;
+// Function executed on the stack region and its argument.
+static TestStackFunc_t k_func = NULL;
+static void           *k_arg  = NULL;
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Entry of the stack region context - makecontext() passes no pointer arguments portably.
+static void entry(void) { k_func(k_arg); }
+
+// ------------------------------------------------------------------
+// Stack API
+
+void rstest_stackRunHost(void *stack, size_t size, TestStackFunc_t func, void *arg, void *user)
+{
+    (void)user;
+    k_func = func;
+    k_arg  = arg;
+    if (getcontext(&k_callee) != 0)
+    {
+        // Unable to switch - execute on the current stack (measured as unused).
+        func(arg);
+        return;
+    }
+    k_callee.uc_stack.ss_sp   = stack;
+    k_callee.uc_stack.ss_size = size;
+    k_callee.uc_link          = &k_caller;
+    makecontext(&k_callee, &entry, 0);
+    (void)swapcontext(&k_caller, &k_callee);
+}
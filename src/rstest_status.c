@@ -0,0 +1,178 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork live status block.
+//
+
+#include "rstest/rstest_status.h"
+#include "rstest_internal.h"
+
+#include <string.h>
+
+/// Full memory barrier ordering the sequence against the status block contents.
+#if defined(__GNUC__) || defined(__clang__)
+#define STATUS_BARRIER() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#else
+#define STATUS_BARRIER()
+#endif
+
+/// Retries of rstest_statusRead() before giving up on a consistent copy.
+#define STATUS_READ_RETRIES (100U)
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Status block updated while running (NULL when none).
+static TestStatus_t *k_status = NULL;
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Start updating the status block - sequence becomes odd.
+static void beginUpdate(void)
+{
+    k_status->sequence = k_status->sequence + 1U;
+    STATUS_BARRIER();
+}
+
+/// Complete updating the status block - sequence becomes even.
+static void endUpdate(void)
+{
+    STATUS_BARRIER();
+    k_status->sequence = k_status->sequence + 1U;
+}
+
+/// Copy a (possibly truncated) name into the status block.
+/// @param[out] dst destination of RSTEST_STATUS_NAME_SIZE
+/// @param[in] src name (NULL for none)
+static void copyName(char *dst, const char *src)
+{
+    size_t idx = 0U;
+    for (; (src != NULL) && (src[idx] != '\0') && (idx < (RSTEST_STATUS_NAME_SIZE - 1U)); idx++)
+    {
+        dst[idx] = src[idx];
+    }
+    dst[idx] = '\0';
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_statusBegin(const char *suiteName, size_t caseCount)
+{
+    if (k_status == NULL)
+    {
+        return;
+    }
+    beginUpdate();
+    k_status->running   = 1U;
+    k_status->caseCount = (uint32_t)caseCount;
+    k_status->caseIndex = RSTEST_STATUS_NO_CASE;
+    for (size_t idx = 0U; idx < RSTEST_STATUS_STATE_COUNT; idx++)
+    {
+        k_status->stateCount[idx] = 0U;
+    }
+    k_status->stateCount[TestCaseState_Idle] = (uint32_t)caseCount;
+    copyName(k_status->suiteName, suiteName);
+    copyName(k_status->caseName, NULL);
+    endUpdate();
+}
+
+void rstest_statusCase(size_t caseIndex, const char *name, TestCaseState_t from, TestCaseState_t to)
+{
+    if (k_status == NULL)
+    {
+        return;
+    }
+    beginUpdate();
+    k_status->caseIndex = (uint32_t)caseIndex;
+    copyName(k_status->caseName, name);
+    k_status->stateCount[from]--;
+    k_status->stateCount[to]++;
+    endUpdate();
+}
+
+void rstest_statusFailure(size_t caseIndex, const AssertRecord_t *rec)
+{
+    if (k_status == NULL)
+    {
+        return;
+    }
+    beginUpdate();
+    k_status->failAssertCount++;
+    k_status->lastFailure.caseIndex = (uint32_t)caseIndex;
+    k_status->lastFailure.line      = rec->line;
+    k_status->lastFailure.param     = rec->param;
+    copyName(k_status->lastFailure.file, rec->file);
+    endUpdate();
+}
+
+void rstest_statusEnd(void)
+{
+    if (k_status == NULL)
+    {
+        return;
+    }
+    beginUpdate();
+    k_status->running = 0U;
+    k_status->runCount++;
+    endUpdate();
+}
+
+// ------------------------------------------------------------------
+// Status API
+
+void rstest_setStatus(TestStatus_t *status)
+{
+    k_status = status;
+    if (status == NULL)
+    {
+        return;
+    }
+    // Keep the sequence so a reader of a re-used block never sees it go back.
+    const uint32_t sequence = status->sequence | 1U;
+    status->sequence        = sequence;
+    STATUS_BARRIER();
+    memset(&(status->running), 0, sizeof(TestStatus_t) - offsetof(TestStatus_t, running));
+    status->magic                 = RSTEST_STATUS_MAGIC;
+    status->version               = RSTEST_STATUS_VERSION;
+    status->caseIndex             = RSTEST_STATUS_NO_CASE;
+    status->lastFailure.caseIndex = RSTEST_STATUS_NO_CASE;
+    status->lastFailure.param     = RSTEST_NO_PARAM;
+    STATUS_BARRIER();
+    status->sequence = sequence + 1U;
+}
+
+bool rstest_statusRead(const TestStatus_t *status, TestStatus_t *copy)
+{
+    for (uint32_t retry = 0U; retry < STATUS_READ_RETRIES; retry++)
+    {
+        const uint32_t before = status->sequence;
+        STATUS_BARRIER();
+        memcpy(copy, (const void *)status, sizeof(TestStatus_t));
+        STATUS_BARRIER();
+        if (((before & 1U) == 0U) && (before == status->sequence))
+        {
+            return (copy->magic == RSTEST_STATUS_MAGIC) && (copy->version == RSTEST_STATUS_VERSION);
+        }
+    }
+    return false;
+}
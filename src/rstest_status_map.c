@@ -0,0 +1,63 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork live status block in a memory mapped
+/// file (host only).
+//
+
+#define _POSIX_C_SOURCE 200809L // mmap, ftruncate
+
+#include "rstest/rstest_status.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+TestStatus_t *rstest_statusMapFile(const char *path, bool create)
+{
+    const int fd = open(path, create ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    // Reading beyond the end of the file faults - size it or confirm its size.
+    struct stat info;
+    if ((create && (ftruncate(fd, (off_t)sizeof(TestStatus_t)) != 0)) || (fstat(fd, &info) != 0) ||
+        ((size_t)info.st_size < sizeof(TestStatus_t)))
+    {
+        (void)close(fd);
+        return NULL;
+    }
+
+    void *mem = mmap(NULL, sizeof(TestStatus_t), create ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd); // The mapping remains valid.
+    return (mem == MAP_FAILED) ? NULL : (TestStatus_t *)mem;
+}
+
+void rstest_statusUnmapFile(TestStatus_t *status)
+{
+    if (status != NULL)
+    {
+        (void)munmap(status, sizeof(TestStatus_t));
+    }
+}
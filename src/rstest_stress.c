@@ -0,0 +1,163 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork concurrency stress test cases.
+//
+
+#include "rstest/rstest_stress.h"
+#include "rstest_internal.h"
+
+#include <stdlib.h>
+
+// ------------------------------------------------------------------
+// Defines
+
+/// Arrive at the start barrier and wait for every thread - atomic so the threads need no lock.
+#if defined(__GNUC__) || defined(__clang__)
+#define STRESS_ARRIVE(run) __atomic_add_fetch(&((run)->arrived), 1U, __ATOMIC_ACQ_REL)
+#define STRESS_ARRIVED(run) __atomic_load_n(&((run)->arrived), __ATOMIC_ACQUIRE)
+#else
+#define STRESS_ARRIVE(run) (++((run)->arrived))
+#define STRESS_ARRIVED(run) ((run)->arrived)
+#endif
+
+// ------------------------------------------------------------------
+// Local Types
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+/// Stress run shared by the threads.
+typedef struct StressRun_s
+{
+    const TestStress_t *stress;                           ///< Stress definition
+    volatile uint32_t   arrived;                          ///< Threads arrived at the start barrier
+    uint64_t            start[RSTEST_STRESS_MAX_THREADS]; ///< Clock of each thread at the start of the iterations
+    uint64_t            end[RSTEST_STRESS_MAX_THREADS];   ///< Clock of each thread at the end of the iterations
+} StressRun_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Runner of the stress test cases (NULL when none).
+static TestStressRunCb_t k_stressRunCb = NULL;
+
+// User pointer of the runner.
+static void *k_stressRunCbUser = NULL;
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Operations per second.
+/// @param[in] ops operations executed
+/// @param[in] ticks clock ticks the operations took
+/// @param[in] clockHz clock ticks per second
+/// @returns the operations per second, 0 when unknown
+static uint64_t stressOpsPerSec(uint64_t ops, uint64_t ticks, uint64_t clockHz)
+{
+    if ((ticks == 0U) || (clockHz == 0U))
+    {
+        return 0U;
+    }
+    return (ops * (clockHz / ticks)) + ((ops * (clockHz % ticks)) / ticks);
+}
+
+/// Worker of each thread: wait for every thread at the start barrier, then execute the iterations.
+/// @param[in] thread index of the thread
+/// @param[in,out] arg stress run (StressRun_t)
+static void stressWorker(uint32_t thread, void *arg)
+{
+    StressRun_t        *run    = (StressRun_t *)arg;
+    const TestStress_t *stress = run->stress;
+
+    (void)STRESS_ARRIVE(run);
+    while (STRESS_ARRIVED(run) < stress->threads)
+    {
+    }
+
+    run->start[thread] = rstest_readClock();
+    for (uint32_t iteration = 0U; iteration < stress->iterations; iteration++)
+    {
+        stress->func(thread, iteration, stress->user);
+    }
+    run->end[thread] = rstest_readClock();
+}
+
+// ------------------------------------------------------------------
+// Stress API
+
+void rstest_setStressRunner(TestStressRunCb_t runCb, void *user)
+{
+    k_stressRunCb     = runCb;
+    k_stressRunCbUser = user;
+}
+
+void rstest_stressCase(const void *param, size_t index)
+{
+    (void)index;
+    const TestStress_t *stress = (const TestStress_t *)param;
+    TestStressResult_t  result = {0U, 0U, 0U};
+    StressRun_t         run    = {0};
+    run.stress                 = stress;
+    START_TESTCASE();
+
+    const bool valid = (stress->func != NULL) && (stress->threads > 0U) &&
+                       (stress->threads <= RSTEST_STRESS_MAX_THREADS) && (k_stressRunCb != NULL);
+    ASSERT_TRUE(valid);
+    rstest_assertThreaded = true;
+    const bool ran        = valid && k_stressRunCb(stress->threads, &stressWorker, &run, k_stressRunCbUser);
+    rstest_assertThreaded = false;
+    ASSERT_TRUE(!valid || ran);
+
+    if (ran)
+    {
+        uint64_t first      = run.start[0];
+        uint64_t last       = run.end[0];
+        result.threads      = stress->threads;
+        result.minOpsPerSec = UINT64_MAX;
+        for (uint32_t thread = 0U; thread < stress->threads; thread++)
+        {
+            const uint64_t opsPerSec =
+                stressOpsPerSec(stress->iterations, run.end[thread] - run.start[thread], stress->clockHz);
+            result.minOpsPerSec = (opsPerSec < result.minOpsPerSec) ? opsPerSec : result.minOpsPerSec;
+            first               = (run.start[thread] < first) ? run.start[thread] : first;
+            last                = (run.end[thread] > last) ? run.end[thread] : last;
+            if (stress->threadOpsPerSec != NULL)
+            {
+                stress->threadOpsPerSec[thread] = opsPerSec;
+            }
+        }
+        result.opsPerSec =
+            stressOpsPerSec((uint64_t)stress->iterations * stress->threads, last - first, stress->clockHz);
+    }
+
+    if (stress->result != NULL)
+    {
+        *(stress->result) = result;
+    }
+    END_TESTCASE_PASS();
+}
@@ -0,0 +1,116 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork stress runner of a host (pthreads).
+//
+
+#include "rstest/rstest_stress.h"
+
+#include <pthread.h>
+
+// ------------------------------------------------------------------
+// Local Types
+
+/// Start of the threads - released once every thread was created.
+typedef enum HostStart_e
+{
+    HostStart_Wait  = 0, ///< Creating the threads
+    HostStart_Run   = 1, ///< Every thread created, execute the worker
+    HostStart_Abort = 2  ///< A thread could not be created, return without the worker
+} HostStart_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wpadded"
+#endif
+
+/// Run shared by the threads.
+typedef struct HostRun_s
+{
+    TestStressWorker_t worker; ///< Worker of the threads
+    void              *arg;    ///< Argument of the worker
+    int                start;  ///< HostStart_t
+} HostRun_t;
+
+/// Thread of the run.
+typedef struct HostThread_s
+{
+    pthread_t  thread; ///< Thread
+    HostRun_t *run;    ///< Run of the thread
+    uint32_t   index;  ///< Index of the thread
+} HostThread_t;
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Entry of a thread: wait until every thread was created, then execute the worker.
+/// @param[in] arg thread (HostThread_t)
+/// @returns NULL
+static void *hostEntry(void *arg)
+{
+    const HostThread_t *thread = (const HostThread_t *)arg;
+    int                 start  = HostStart_Wait;
+    while ((start = __atomic_load_n(&(thread->run->start), __ATOMIC_ACQUIRE)) == HostStart_Wait)
+    {
+    }
+    if (start == HostStart_Run)
+    {
+        thread->run->worker(thread->index, thread->run->arg);
+    }
+    return NULL;
+}
+
+// ------------------------------------------------------------------
+// Stress API
+
+bool rstest_stressRunHost(uint32_t threads, TestStressWorker_t worker, void *arg, void *user)
+{
+    (void)user;
+    HostRun_t    run = {worker, arg, HostStart_Wait};
+    HostThread_t list[RSTEST_STRESS_MAX_THREADS];
+    uint32_t     created = 0U;
+    if (threads > RSTEST_STRESS_MAX_THREADS)
+    {
+        return false;
+    }
+
+    for (; created < threads; created++)
+    {
+        list[created].run   = &run;
+        list[created].index = created;
+        if (pthread_create(&(list[created].thread), NULL, &hostEntry, &(list[created])) != 0)
+        {
+            break;
+        }
+    }
+
+    // The workers wait for each other - start them only when all of them can execute.
+    __atomic_store_n(&(run.start), (created == threads) ? HostStart_Run : HostStart_Abort, __ATOMIC_RELEASE);
+    for (uint32_t idx = 0U; idx < created; idx++)
+    {
+        (void)pthread_join(list[idx].thread, NULL);
+    }
+    return (created == threads);
+}
@@ -0,0 +1,135 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork virtual time.
+//
+
+#include "rstest/rstest_time.h"
+
+#include <stddef.h>
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Virtual time of the test case.
+static uint64_t k_timeNow = 0U;
+
+// Pending timers in deadline order (equal deadlines in start order).
+static TestTimer_t *k_timers = NULL;
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Link a timer into the pending timers at its deadline.
+/// @param[in,out] timer timer, not pending
+static void timerInsert(TestTimer_t *timer)
+{
+    TestTimer_t **link = &k_timers;
+    while ((*link != NULL) && ((*link)->deadline <= timer->deadline))
+    {
+        link = &((*link)->next);
+    }
+    timer->next    = *link;
+    timer->pending = true;
+    *link          = timer;
+}
+
+/// Execute the timers expiring up to a virtual time, in deadline order.
+/// @param[in] until virtual time to execute the timers up to
+/// @returns the count of timers executed
+static uint32_t timerExpire(uint64_t until)
+{
+    uint32_t count = 0U;
+    while ((k_timers != NULL) && (k_timers->deadline <= until))
+    {
+        TestTimer_t *timer = k_timers;
+        k_timers           = timer->next;
+        timer->next        = NULL;
+        timer->pending     = false;
+        k_timeNow          = (timer->deadline > k_timeNow) ? timer->deadline : k_timeNow;
+        if (timer->period != 0U)
+        {
+            // Re-armed before the callback so it can stop the timer.
+            timer->deadline += timer->period;
+            timerInsert(timer);
+        }
+        timer->cb(timer, timer->user);
+        count++;
+    }
+    return count;
+}
+
+// ------------------------------------------------------------------
+// Virtual Time API
+
+uint64_t rstest_now(void) { return k_timeNow; }
+
+void rstest_sleep(uint64_t ticks)
+{
+    const uint64_t until = k_timeNow + ticks;
+    (void)timerExpire(until);
+    // A callback sleeping may have advanced beyond.
+    k_timeNow = (until > k_timeNow) ? until : k_timeNow;
+}
+
+bool rstest_sleepUntilNext(void)
+{
+    if (k_timers == NULL)
+    {
+        return false;
+    }
+    return (timerExpire(k_timers->deadline) != 0U);
+}
+
+void rstest_timerStart(TestTimer_t *timer, uint64_t delay, uint64_t period, TestTimerCb_t cb, void *user)
+{
+    rstest_timerStop(timer);
+    timer->deadline = k_timeNow + delay;
+    timer->period   = period;
+    timer->cb       = cb;
+    timer->user     = user;
+    timerInsert(timer);
+}
+
+void rstest_timerStop(TestTimer_t *timer)
+{
+    if (!timer->pending)
+    {
+        return;
+    }
+    for (TestTimer_t **link = &k_timers; *link != NULL; link = &((*link)->next))
+    {
+        if (*link == timer)
+        {
+            *link = timer->next;
+            break;
+        }
+    }
+    timer->next    = NULL;
+    timer->pending = false;
+}
+
+void rstest_timeReset(void)
+{
+    // Dropped without access - the timers may have been on the stack of the previous test case.
+    k_timers  = NULL;
+    k_timeNow = 0U;
+}
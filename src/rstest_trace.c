@@ -0,0 +1,97 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork execution trace.
+//
+
+#include "rstest/rstest_trace.h"
+#include "rstest_internal.h"
+
+/// Reserve the next event of the trace - atomic so workers need no lock.
+#if defined(__GNUC__) || defined(__clang__)
+#define TRACE_RESERVE(trace) __atomic_fetch_add(&((trace)->head), 1U, __ATOMIC_RELAXED)
+#else
+#define TRACE_RESERVE(trace) ((trace)->head++)
+#endif
+
+// ------------------------------------------------------------------
+// Local Static Variables
+
+// Trace recorded while running (NULL when none).
+static TestTrace_t *k_trace = NULL;
+
+// ------------------------------------------------------------------
+// Trace API
+
+bool rstest_setTrace(TestTrace_t *trace)
+{
+    if ((trace != NULL) && ((trace->capacity == 0U) || ((trace->capacity & (trace->capacity - 1U)) != 0U)))
+    {
+        k_trace = NULL;
+        return false;
+    }
+    k_trace = trace;
+    if (k_trace != NULL)
+    {
+        k_trace->head = 0U;
+    }
+    return true;
+}
+
+void rstest_traceEvent(TestTraceKind_t kind, bool begin, uint32_t caseIndex, const char *name, uint16_t worker)
+{
+    TestTrace_t *trace = k_trace;
+    if (trace == NULL)
+    {
+        return;
+    }
+    TestClockCb_t     clockCb = trace->clockCb;
+    const uint32_t    slot    = TRACE_RESERVE(trace) & (trace->capacity - 1U);
+    TestTraceEvent_t *event   = &(trace->events[slot]);
+    event->time               = (clockCb != NULL) ? clockCb(trace->clockCbUser) : 0U;
+    event->name               = name;
+    event->caseIndex          = caseIndex;
+    event->worker             = worker;
+    event->kind               = (uint8_t)kind;
+    event->begin              = begin ? 1U : 0U;
+}
+
+uint32_t rstest_traceCount(const TestTrace_t *trace)
+{
+    return (trace->head < trace->capacity) ? trace->head : trace->capacity;
+}
+
+const TestTraceEvent_t *rstest_traceGet(const TestTrace_t *trace, uint32_t index)
+{
+    const uint32_t first = trace->head - rstest_traceCount(trace);
+    return &(trace->events[(first + index) & (trace->capacity - 1U)]);
+}
+
+// ------------------------------------------------------------------
+// Internal Functions
+
+void rstest_traceDiscard(void)
+{
+    if (k_trace != NULL)
+    {
+        k_trace->head = 0U;
+    }
+}
@@ -0,0 +1,115 @@
+/// @copyright 2026 Retlek Systems Inc.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+///
+/// @brief Really Small Test Framwork execution trace Chrome trace JSON export
+/// (host only).
+//
+
+#include "rstest/rstest_trace.h"
+
+#include <stdio.h>
+
+// ------------------------------------------------------------------
+// Local Functions
+
+/// Category of the events of a kind.
+/// @param[in] kind TestTraceKind_t of the event
+/// @returns the category name
+static const char *category(uint8_t kind)
+{
+    static const char *const k_categories[] = {"suite", "startup", "body", "teardown", "failure"};
+    return (kind < (sizeof(k_categories) / sizeof(k_categories[0]))) ? k_categories[kind] : "unknown";
+}
+
+/// Write a JSON string (quoted and escaped).
+/// @param[in,out] stream file to write to
+/// @param[in] str string to write (NULL is written as an empty string)
+/// @retval true when written
+/// @retval false otherwise
+static bool writeString(FILE *stream, const char *str)
+{
+    bool ok = (fputc('"', stream) != EOF);
+    for (; ok && (str != NULL) && (*str != '\0'); str++)
+    {
+        const unsigned char c = (unsigned char)*str;
+        if ((c == '"') || (c == '\\'))
+        {
+            ok = (fprintf(stream, "\\%c", c) > 0);
+        }
+        else if (c < 0x20U)
+        {
+            ok = (fprintf(stream, "\\u%04x", (unsigned)c) > 0);
+        }
+        else
+        {
+            ok = (fputc(c, stream) != EOF);
+        }
+    }
+    return ok && (fputc('"', stream) != EOF);
+}
+
+/// Write a trace event as a Chrome trace event.
+/// @param[in,out] stream file to write to
+/// @param[in] event trace event
+/// @param[in] ticksPerUs clock ticks per microsecond
+/// @retval true when written
+/// @retval false otherwise
+static bool writeEvent(FILE *stream, const TestTraceEvent_t *event, uint64_t ticksPerUs)
+{
+    // Timestamps are microseconds, kept to ns resolution.
+    const unsigned long long whole = (unsigned long long)(event->time / ticksPerUs);
+    const unsigned long long frac  = (unsigned long long)(((event->time % ticksPerUs) * 1000U) / ticksPerUs);
+
+    bool ok = (fputs("{\"name\":", stream) != EOF) && writeString(stream, event->name);
+    ok      = ok && (fprintf(stream, ",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03llu,\"pid\":1,\"tid\":%u",
+                             category(event->kind), (event->begin != 0U) ? 'B' : 'E', whole, frac,
+                             (unsigned)event->worker) > 0);
+    if (ok && (event->caseIndex != RSTEST_TRACE_NO_CASE))
+    {
+        ok = (fprintf(stream, ",\"args\":{\"case\":%u}", (unsigned)event->caseIndex) > 0);
+    }
+    return ok && (fputc('}', stream) != EOF);
+}
+
+// ------------------------------------------------------------------
+// Trace API
+
+bool rstest_traceExport(const TestTrace_t *trace, const char *path, uint64_t ticksPerUs)
+{
+    FILE *stream = fopen(path, "w");
+    if (stream == NULL)
+    {
+        return false;
+    }
+
+    ticksPerUs = (ticksPerUs == 0U) ? 1U : ticksPerUs;
+
+    const uint32_t count = rstest_traceCount(trace);
+    bool           ok    = (fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", stream) != EOF);
+    for (uint32_t idx = 0U; ok && (idx < count); idx++)
+    {
+        ok = writeEvent(stream, rstest_traceGet(trace, idx), ticksPerUs) &&
+             (fputs((idx + 1U < count) ? ",\n" : "\n", stream) != EOF);
+    }
+    ok = ok && (fputs("]}\n", stream) != EOF);
+    ok = (fclose(stream) == 0) && ok;
+    return ok;
+}